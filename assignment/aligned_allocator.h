@@ -0,0 +1,97 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Allocator returning memory aligned to a given boundary
+//
+// $NoKeywords: $ivs_project_1 $aligned_allocator.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file aligned_allocator.h
+ * @author Hung Do
+ *
+ * @brief Definice a implementace alokatoru se zarovnanim pro std::vector.
+ */
+
+#pragma once
+
+#ifndef ALIGNED_ALLOCATOR_H_
+#define ALIGNED_ALLOCATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <new>
+
+/**
+ * @brief The AlignedAllocator class
+ * Alokator pro kontejnery standardni knihovny, ktery vraci pamet zarovnanou
+ * na "Alignment" bajtu (vychozi velikost radku cache). Pamet se alokuje
+ * pomoci malloc s rezervou, ukazatel na puvodni blok je ulozen tesne pred
+ * zarovnanou adresou.
+ */
+template <typename T, size_t Alignment = 64>
+class AlignedAllocator
+{
+public:
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind {
+        typedef AlignedAllocator<U, Alignment> other;
+    };
+
+    AlignedAllocator()
+    {
+    }
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment> &)
+    {
+    }
+
+    /**
+     * @brief allocate
+     * Alokuje zarovnanou pamet pro "count" polozek.
+     * @throw std::bad_alloc Pokud se pamet nepodarilo alokovat.
+     */
+    T *allocate(size_t count)
+    {
+        size_t extra = Alignment - 1 + sizeof(void *);
+        if (count > (static_cast<size_t>(-1) - extra) / sizeof(T))
+            throw std::bad_alloc();
+
+        void *raw = malloc(count * sizeof(T) + extra);
+        if (raw == nullptr)
+            throw std::bad_alloc();
+
+        uintptr_t address = (reinterpret_cast<uintptr_t>(raw) + extra) & ~static_cast<uintptr_t>(Alignment - 1);
+        reinterpret_cast<void **>(address)[-1] = raw;
+        return reinterpret_cast<T *>(address);
+    }
+
+    /**
+     * @brief deallocate
+     * Uvolni pamet alokovanou metodou allocate.
+     */
+    void deallocate(T *pointer, size_t)
+    {
+        if (pointer != nullptr)
+            free(reinterpret_cast<void **>(pointer)[-1]);
+    }
+};
+
+template <typename T, typename U, size_t Alignment>
+inline bool operator==(const AlignedAllocator<T, Alignment> &, const AlignedAllocator<U, Alignment> &)
+{
+    return true;
+}
+
+template <typename T, typename U, size_t Alignment>
+inline bool operator!=(const AlignedAllocator<T, Alignment> &, const AlignedAllocator<U, Alignment> &)
+{
+    return false;
+}
+
+#endif // ALIGNED_ALLOCATOR_H_
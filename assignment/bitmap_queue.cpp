@@ -0,0 +1,242 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - sparse hierarchical bitmap over int keys
+//
+// $NoKeywords: $ivs_project_1 $bitmap_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file bitmap_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty nad hierarchickou bitovou mapou
+ * celeho rozsahu typu "int".
+ */
+
+#include "bitmap_queue.h"
+
+const unsigned BitmapPriorityQueue::LEVEL_BITS;
+const unsigned BitmapPriorityQueue::LEVELS;
+
+namespace {
+
+/**
+ * @brief ToKey
+ * @return Vraci klic hodnoty "value", poradi klicu (bez znamenka) odpovida
+ * poradi hodnot.
+ */
+inline uint64_t ToKey(int value)
+{
+    return static_cast<uint32_t>(value) ^ 0x80000000u;
+}
+
+/**
+ * @brief ToValue
+ * @return Vraci hodnotu klice "key".
+ */
+inline int ToValue(uint64_t key)
+{
+    return static_cast<int>(static_cast<uint32_t>(key) ^ 0x80000000u);
+}
+
+/**
+ * @brief LowestBit
+ * @return Vraci index nejnizsiho nastaveneho bitu nenuloveho slova "word".
+ */
+inline unsigned LowestBit(uint64_t word)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned index = 0;
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief HighestBit
+ * @return Vraci index nejvyssiho nastaveneho bitu nenuloveho slova "word".
+ */
+inline unsigned HighestBit(uint64_t word)
+{
+#if defined(__GNUC__)
+    return 63 - static_cast<unsigned>(__builtin_clzll(word));
+#else
+    unsigned index = 0;
+    while ((word >>= 1) != 0)
+        index++;
+    return index;
+#endif
+}
+
+/**
+ * @brief MaskAbove
+ * @return Vraci masku bitu slova s indexem vetsim nez "bit".
+ */
+inline uint64_t MaskAbove(unsigned bit)
+{
+    return bit == 63 ? 0 : ~static_cast<uint64_t>(0) << (bit + 1);
+}
+
+/**
+ * @brief MaskBelow
+ * @return Vraci masku bitu slova s indexem mensim nez "bit".
+ */
+inline uint64_t MaskBelow(unsigned bit)
+{
+    return (static_cast<uint64_t>(1) << bit) - 1;
+}
+
+} // namespace
+
+BitmapPriorityQueue::BitmapPriorityQueue()
+    : m_top(0), m_length(0)
+{
+}
+
+void BitmapPriorityQueue::Insert(int value)
+{
+    m_length++;
+    if (m_counts[static_cast<uint32_t>(ToKey(value))]++ != 0)
+        return;
+
+    // Nastaveni bitu od listu ke koreni, dokud slovo nebylo prazdne
+    uint64_t key = ToKey(value);
+    for (unsigned level = 0; level < LEVELS; level++)
+    {
+        uint64_t bit = static_cast<uint64_t>(1) << ((key >> (LEVEL_BITS * level)) & 63);
+        if (level == LEVELS - 1)
+        {
+            m_top |= bit;
+            break;
+        }
+
+        uint64_t &word = m_levels[level][static_cast<uint32_t>(key >> (LEVEL_BITS * (level + 1)))];
+        bool wasEmpty = word == 0;
+        word |= bit;
+        if (!wasEmpty)
+            break;
+    }
+}
+
+bool BitmapPriorityQueue::Remove(int value)
+{
+    uint64_t key = ToKey(value);
+    std::unordered_map<uint32_t, size_t>::iterator count = m_counts.find(static_cast<uint32_t>(key));
+    if (count == m_counts.end())
+        return false;
+
+    m_length--;
+    if (--count->second != 0)
+        return true;
+    m_counts.erase(count);
+
+    // Nulovani bitu od listu ke koreni, prazdne uzly se odstrani
+    for (unsigned level = 0; level < LEVELS; level++)
+    {
+        uint64_t bit = static_cast<uint64_t>(1) << ((key >> (LEVEL_BITS * level)) & 63);
+        if (level == LEVELS - 1)
+        {
+            m_top &= ~bit;
+            break;
+        }
+
+        std::unordered_map<uint32_t, uint64_t>::iterator word =
+            m_levels[level].find(static_cast<uint32_t>(key >> (LEVEL_BITS * (level + 1))));
+        word->second &= ~bit;
+        if (word->second != 0)
+            break;
+        m_levels[level].erase(word);
+    }
+    return true;
+}
+
+bool BitmapPriorityQueue::Find(int value) const
+{
+    return m_counts.find(static_cast<uint32_t>(ToKey(value))) != m_counts.end();
+}
+
+size_t BitmapPriorityQueue::Count(int value) const
+{
+    std::unordered_map<uint32_t, size_t>::const_iterator count =
+        m_counts.find(static_cast<uint32_t>(ToKey(value)));
+    return count != m_counts.end() ? count->second : 0;
+}
+
+size_t BitmapPriorityQueue::Length() const
+{
+    return m_length;
+}
+
+bool BitmapPriorityQueue::GetTop(int &value) const
+{
+    if (m_top == 0)
+        return false;
+
+    value = Descend(LEVELS - 1, 0, true);
+    return true;
+}
+
+bool BitmapPriorityQueue::PopTop(int &value)
+{
+    if (!GetTop(value))
+        return false;
+    return Remove(value);
+}
+
+bool BitmapPriorityQueue::Successor(int value, int &result) const
+{
+    return Neighbor(ToKey(value), true, result);
+}
+
+bool BitmapPriorityQueue::Predecessor(int value, int &result) const
+{
+    return Neighbor(ToKey(value), false, result);
+}
+
+uint64_t BitmapPriorityQueue::Word(unsigned level, uint64_t index) const
+{
+    if (level == LEVELS - 1)
+        return m_top;
+
+    std::unordered_map<uint32_t, uint64_t>::const_iterator word =
+        m_levels[level].find(static_cast<uint32_t>(index));
+    return word != m_levels[level].end() ? word->second : 0;
+}
+
+int BitmapPriorityQueue::Descend(unsigned level, uint64_t index, bool highest) const
+{
+    // "index" je index slova na urovni "level", kazdy krok pripoji 6 bitu
+    for (unsigned l = level + 1; l-- > 0;)
+    {
+        uint64_t word = Word(l, index);
+        index = index << LEVEL_BITS | (highest ? HighestBit(word) : LowestBit(word));
+    }
+    return ToValue(index);
+}
+
+bool BitmapPriorityQueue::Neighbor(uint64_t key, bool above, int &result) const
+{
+    // Stoupani ke koreni, dokud slovo nema souseda na spravne strane
+    for (unsigned level = 0; level < LEVELS; level++)
+    {
+        uint64_t index = key >> (LEVEL_BITS * (level + 1));
+        unsigned bit = (key >> (LEVEL_BITS * level)) & 63;
+        uint64_t word = Word(level, index) & (above ? MaskAbove(bit) : MaskBelow(bit));
+        if (word == 0)
+            continue;
+
+        uint64_t child = index << LEVEL_BITS | (above ? LowestBit(word) : HighestBit(word));
+        result = level == 0 ? ToValue(child) : Descend(level - 1, child, !above);
+        return true;
+    }
+    return false;
+}
+
+/*** Konec souboru bitmap_queue.cpp ***/
@@ -0,0 +1,161 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - sparse hierarchical bitmap over int keys
+//
+// $NoKeywords: $ivs_project_1 $bitmap_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file bitmap_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty nad hierarchickou bitovou mapou
+ * celeho rozsahu typu "int".
+ */
+
+#pragma once
+
+#ifndef BITMAP_QUEUE_H_
+#define BITMAP_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <unordered_map>
+
+/**
+ * @brief The BitmapPriorityQueue class
+ * Prioritni fronta hodnot z celeho rozsahu typu "int" (po vzoru van Emde
+ * Boasova stromu). Hodnoty tvori listy stromu s vetvenim 64, kazdy uzel je
+ * jedno 64bitove slovo s bitem pro kazdeho neprazdneho potomka. Pro 32bitove
+ * hodnoty ma strom 6 urovni, Insert, Remove, vrchol i nasledovnik se tak
+ * najdou nekolika instrukcemi (tzcnt/lzcnt) na kazde urovni. Uzly jsou
+ * ulozeny v hashovacich tabulkach podle prefixu hodnoty, pamet je tedy
+ * umerna poctu ruznych hodnot, ne velikosti rozsahu. Duplicitni hodnoty se
+ * pocitaji.
+ */
+class BitmapPriorityQueue
+{
+public:
+    /**
+     * @brief BitmapPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu.
+     */
+    BitmapPriorityQueue();
+
+    BitmapPriorityQueue(const BitmapPriorityQueue &) = delete;
+    BitmapPriorityQueue &operator=(const BitmapPriorityQueue &) = delete;
+
+    /**
+     * @brief Insert
+     * Vlozi hodnotu "value" do fronty. Slozitost O(log64 U).
+     * @param value Vkladana hodnota.
+     */
+    void Insert(int value);
+
+    /**
+     * @brief Remove
+     * Odstrani jeden vyskyt hodnoty "value" z fronty. Slozitost O(log64 U).
+     * @param value Odstranovana hodnota.
+     * @return Vrati true, pokud byla hodnota nalezena a odstranena, jinak false.
+     */
+    bool Remove(int value);
+
+    /**
+     * @brief Find
+     * Slozitost O(1).
+     * @param value Hledana hodnota.
+     * @return Vrati true, pokud se hodnota nachazi ve fronte, jinak false.
+     */
+    bool Find(int value) const;
+
+    /**
+     * @brief Count
+     * @param value Hledana hodnota.
+     * @return Vraci pocet vyskytu hodnoty "value" ve fronte.
+     */
+    size_t Count(int value) const;
+
+    /**
+     * @brief Length
+     * Vraci pocet hodnot ve fronte (vcetne duplicit). Delka prazdne fronty je 0.
+     * @return Vrati delku fronty.
+     */
+    size_t Length() const;
+
+    /**
+     * @brief GetTop
+     * Nalezne nejvetsi hodnotu ve fronte.
+     * @param value Vystupni parametr, do ktereho se ulozi nejvetsi hodnota.
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool GetTop(int &value) const;
+
+    /**
+     * @brief PopTop
+     * Odstrani z fronty jeden vyskyt nejvetsi hodnoty.
+     * @param value Vystupni parametr, do ktereho se ulozi odstranena hodnota.
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopTop(int &value);
+
+    /**
+     * @brief Successor
+     * Nalezne nejmensi hodnotu ve fronte, ktera je vetsi nez "value".
+     * @param value Hodnota, od ktere se hleda (nemusi byt ve fronte).
+     * @param result Vystupni parametr, do ktereho se ulozi nalezena hodnota.
+     * @return Vrati false, pokud takova hodnota neexistuje, jinak true.
+     */
+    bool Successor(int value, int &result) const;
+
+    /**
+     * @brief Predecessor
+     * Nalezne nejvetsi hodnotu ve fronte, ktera je mensi nez "value". Pruchod
+     * frontou od vrcholu tedy tvori GetTop a opakovane volani Predecessor.
+     * @param value Hodnota, od ktere se hleda (nemusi byt ve fronte).
+     * @param result Vystupni parametr, do ktereho se ulozi nalezena hodnota.
+     * @return Vrati false, pokud takova hodnota neexistuje, jinak true.
+     */
+    bool Predecessor(int value, int &result) const;
+
+protected:
+    /**
+     * @brief Pocet bitu klice zpracovanych jednou urovni (vetveni 64).
+     */
+    static const unsigned LEVEL_BITS = 6;
+
+    /**
+     * @brief Pocet urovni stromu pro 32bitove klice.
+     */
+    static const unsigned LEVELS = (32 + LEVEL_BITS - 1) / LEVEL_BITS;
+
+    /**
+     * @brief Word
+     * @return Vraci slovo urovne "level" s indexem (prefixem klice) "index",
+     * nebo 0, pokud uzel neexistuje.
+     */
+    uint64_t Word(unsigned level, uint64_t index) const;
+
+    /**
+     * @brief Descend
+     * Sestoupi od bitu "index" slova urovne "level" k listu pres nejvetsi
+     * (highest) nebo nejmensi neprazdne potomky.
+     * @return Vraci nalezenou hodnotu.
+     */
+    int Descend(unsigned level, uint64_t index, bool highest) const;
+
+    /**
+     * @brief Neighbor
+     * Nalezne nejblizsi klic ve fronte nad (above) nebo pod klicem "key".
+     * @return Vrati false, pokud takovy klic neexistuje, jinak true.
+     */
+    bool Neighbor(uint64_t key, bool above, int &result) const;
+
+    std::unordered_map<uint32_t, uint64_t> m_levels[LEVELS - 1]; ///< Uzly nizsich urovni podle prefixu.
+    uint64_t m_top;                                             ///< Korenove slovo.
+    std::unordered_map<uint32_t, size_t> m_counts;              ///< Pocet vyskytu hodnot.
+    size_t m_length;                                            ///< Pocet hodnot ve fronte.
+};
+
+#endif // BITMAP_QUEUE_H_
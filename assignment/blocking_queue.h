@@ -0,0 +1,239 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - blocking producer/consumer wrapper
+//
+// $NoKeywords: $ivs_project_1 $blocking_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file blocking_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice a implementace blokujici prioritni fronty pro producenty a
+ * konzumenty.
+ */
+
+#pragma once
+
+#ifndef BLOCKING_QUEUE_H_
+#define BLOCKING_QUEUE_H_
+
+#include <stddef.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "heap_queue.h"
+
+/**
+ * @brief The BlockingPriorityQueue class
+ * Vlaknove bezpecna prioritni fronta polozek typu "T" (poradi podle "Compare"
+ * stejne jako BasicPriorityQueue). Konzumenti cekaji na polozky bez aktivniho
+ * cekani, PopUpTo odebere vice polozek pri jednom ziskani zamku. Po uzavreni
+ * (Close) fronta neprijima nove polozky, konzumenti dostanou zbyvajici
+ * polozky a pote se vsechna cekani ukonci.
+ */
+template <typename T, typename Compare = std::less<T> >
+class BlockingPriorityQueue
+{
+public:
+    /**
+     * @brief BlockingPriorityQueue
+     * Konstruktor, vytvori prazdnou otevrenou frontu.
+     * @param compare Porovnani priorit polozek.
+     */
+    explicit BlockingPriorityQueue(const Compare &compare = Compare())
+        : m_queue(compare), m_closed(false)
+    {
+    }
+
+    BlockingPriorityQueue(const BlockingPriorityQueue &) = delete;
+    BlockingPriorityQueue &operator=(const BlockingPriorityQueue &) = delete;
+
+    /**
+     * @brief Push
+     * Vlozi do fronty kopii polozky "value" a probudi jednoho cekajiciho
+     * konzumenta.
+     * @param value Nova polozka.
+     * @return Vrati false, pokud je fronta uzavrena, jinak true.
+     */
+    bool Push(const T &value)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_closed)
+                return false;
+            m_queue.Insert(value);
+        }
+        m_available.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Push
+     * Presune do fronty polozku "value" a probudi jednoho cekajiciho
+     * konzumenta.
+     * @param value Nova polozka.
+     * @return Vrati false, pokud je fronta uzavrena, jinak true.
+     */
+    bool Push(T &&value)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_closed)
+                return false;
+            m_queue.Insert(std::move(value));
+        }
+        m_available.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief WaitPop
+     * Pocka na polozku a odebere polozku s nejvyssi prioritou.
+     * @param value Vystupni parametr, do ktereho se presune odebrana polozka.
+     * @return Vrati false, pokud je fronta uzavrena a prazdna, jinak true.
+     */
+    bool WaitPop(T &value)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_available.wait(lock, [this]() { return m_closed || m_queue.Length() > 0; });
+        return m_queue.PopTop(value);
+    }
+
+    /**
+     * @brief WaitPop
+     * Ceka nejvyse "timeout" na polozku a odebere polozku s nejvyssi
+     * prioritou.
+     * @param value Vystupni parametr, do ktereho se presune odebrana polozka.
+     * @param timeout Nejdelsi doba cekani.
+     * @return Vrati false, pokud cekani vyprselo nebo je fronta uzavrena a
+     * prazdna, jinak true.
+     */
+    template <typename Rep, typename Period>
+    bool WaitPop(T &value, const std::chrono::duration<Rep, Period> &timeout)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_available.wait_for(lock, timeout, [this]() { return m_closed || m_queue.Length() > 0; });
+        return m_queue.PopTop(value);
+    }
+
+    /**
+     * @brief TryPop
+     * Odebere polozku s nejvyssi prioritou, pokud nejaka ve fronte je.
+     * @param value Vystupni parametr, do ktereho se presune odebrana polozka.
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool TryPop(T &value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_queue.PopTop(value);
+    }
+
+    /**
+     * @brief PopUpTo
+     * Pocka na alespon jednu polozku a pri jedinem ziskani zamku odebere az
+     * "count" polozek v poradi priority. Polozky se pridaji na konec "out".
+     * Typ "T" musi mit vychozi konstruktor. Pro "count" 0 se neceka a vrati
+     * se ihned 0.
+     * @param count Nejvetsi pocet odebranych polozek.
+     * @param out Vektor, na jehoz konec se odebrane polozky presunou.
+     * @return Vrati pocet odebranych polozek, 0 pokud je fronta uzavrena a
+     * prazdna nebo je "count" 0.
+     */
+    size_t PopUpTo(size_t count, std::vector<T> &out)
+    {
+        if (count == 0)
+            return 0;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_available.wait(lock, [this]() { return m_closed || m_queue.Length() > 0; });
+        return Drain(count, out);
+    }
+
+    /**
+     * @brief PopUpTo
+     * Jako PopUpTo, na prvni polozku ale ceka nejvyse "timeout". Pro "count"
+     * 0 se neceka a vrati se ihned 0.
+     * @param count Nejvetsi pocet odebranych polozek.
+     * @param out Vektor, na jehoz konec se odebrane polozky presunou.
+     * @param timeout Nejdelsi doba cekani.
+     * @return Vrati pocet odebranych polozek, 0 pokud cekani vyprselo, je
+     * fronta uzavrena a prazdna nebo je "count" 0.
+     */
+    template <typename Rep, typename Period>
+    size_t PopUpTo(size_t count, std::vector<T> &out,
+                   const std::chrono::duration<Rep, Period> &timeout)
+    {
+        if (count == 0)
+            return 0;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_available.wait_for(lock, timeout, [this]() { return m_closed || m_queue.Length() > 0; });
+        return Drain(count, out);
+    }
+
+    /**
+     * @brief Close
+     * Uzavre frontu a probudi vsechny cekajici konzumenty. Polozky, ktere ve
+     * fronte zbyvaji, lze dale odebirat.
+     */
+    void Close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_closed = true;
+        }
+        m_available.notify_all();
+    }
+
+    /**
+     * @brief IsClosed
+     * @return Vraci true, pokud byla fronta uzavrena.
+     */
+    bool IsClosed() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_closed;
+    }
+
+    /**
+     * @brief Length
+     * @return Vraci pocet polozek ve fronte v okamziku volani.
+     */
+    size_t Length() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_queue.Length();
+    }
+
+protected:
+    /**
+     * @brief Drain
+     * Odebere az "count" polozek do "out" (zamek musi byt ziskan).
+     * @return Vrati pocet odebranych polozek.
+     */
+    size_t Drain(size_t count, std::vector<T> &out)
+    {
+        size_t popped = 0;
+        T value;
+        while (popped < count && m_queue.PopTop(value))
+        {
+            out.push_back(std::move(value));
+            popped++;
+        }
+        return popped;
+    }
+
+    BasicPriorityQueue<T, Compare> m_queue;     ///< Polozky fronty (chraneny m_mutex).
+    mutable std::mutex m_mutex;                 ///< Zamek fronty.
+    std::condition_variable m_available;        ///< Signal nove polozky nebo uzavreni.
+    bool m_closed;                              ///< Fronta byla uzavrena.
+};
+
+#endif // BLOCKING_QUEUE_H_
@@ -0,0 +1,171 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - capacity-bounded top-K queue
+//
+// $NoKeywords: $ivs_project_1 $bounded_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file bounded_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice a implementace prioritni fronty s omezenou kapacitou, ktera
+ * uchovava K polozek s nejvyssi prioritou.
+ */
+
+#pragma once
+
+#ifndef BOUNDED_QUEUE_H_
+#define BOUNDED_QUEUE_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "heap_queue.h"
+
+/**
+ * @brief The BoundedPriorityQueue class
+ * Prioritni fronta, ktera z proudu polozek uchovava nejvyse "capacity"
+ * polozek s nejvyssi prioritou podle "Compare" (stejne jako BasicPriorityQueue).
+ * Polozky jsou ulozeny v halde s obracenym porovnanim, na jejim vrcholu je
+ * tedy nejhorsi uchovana polozka. Polozka, ktera neni lepsi nez ona, se
+ * odmitne v case O(1), lepsi polozka ji nahradi v case O(log K). Pamet je po
+ * celou dobu omezena na K polozek.
+ */
+template <typename T, typename Compare = std::less<T> >
+class BoundedPriorityQueue
+{
+public:
+    /**
+     * @brief BoundedPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu a predalokuje misto pro vsechny
+     * polozky.
+     * @param capacity Nejvetsi pocet uchovanych polozek (K).
+     * @param compare Porovnani priorit polozek.
+     */
+    explicit BoundedPriorityQueue(size_t capacity, const Compare &compare = Compare())
+        : m_heap(capacity, Inverted(compare)), m_compare(compare), m_capacity(capacity)
+    {
+    }
+
+    /**
+     * @brief Insert
+     * Nabidne fronte kopii polozky "value". Pokud je fronta plna a polozka
+     * neni lepsi nez nejhorsi uchovana polozka, odmitne se.
+     * @param value Nova polozka.
+     * @return Vrati true, pokud byla polozka prijata, jinak false.
+     */
+    bool Insert(const T &value)
+    {
+        if (m_heap.Length() < m_capacity)
+        {
+            m_heap.Insert(value);
+            return true;
+        }
+        if (m_capacity == 0 || !m_compare(*m_heap.GetTop(), value))
+            return false;
+        m_heap.ReplaceTop(value);
+        return true;
+    }
+
+    /**
+     * @brief Insert
+     * Nabidne fronte polozku "value", ktera se pri prijeti do fronty presune.
+     * Pokud je fronta plna a polozka neni lepsi nez nejhorsi uchovana polozka,
+     * odmitne se.
+     * @param value Nova polozka.
+     * @return Vrati true, pokud byla polozka prijata, jinak false.
+     */
+    bool Insert(T &&value)
+    {
+        if (m_heap.Length() < m_capacity)
+        {
+            m_heap.Insert(std::move(value));
+            return true;
+        }
+        if (m_capacity == 0 || !m_compare(*m_heap.GetTop(), value))
+            return false;
+        m_heap.ReplaceTop(std::move(value));
+        return true;
+    }
+
+    /**
+     * @brief GetWorst
+     * Vraci ukazatel na nejhorsi uchovanou polozku (K-tou nejlepsi, pokud je
+     * fronta plna). Ukazatel je platny do pristi zmeny fronty.
+     * @return Vraci ukazatel na polozku, nebo NULL, pokud je fronta prazdna.
+     */
+    const T *GetWorst() const
+    {
+        return m_heap.GetTop();
+    }
+
+    /**
+     * @brief Length
+     * @return Vraci pocet uchovanych polozek.
+     */
+    size_t Length() const
+    {
+        return m_heap.Length();
+    }
+
+    /**
+     * @brief Capacity
+     * @return Vraci nejvetsi pocet uchovanych polozek (K).
+     */
+    size_t Capacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * @brief ExtractSorted
+     * Presune vsechny uchovane polozky na konec "out" serazene od nejlepsi po
+     * nejhorsi, fronta zustane prazdna. Slozitost O(K log K).
+     * @param out Vektor, na jehoz konec se polozky presunou.
+     */
+    void ExtractSorted(std::vector<T> &out)
+    {
+        size_t begin = out.size();
+        out.reserve(begin + m_heap.Length());
+
+        // Halda vydava polozky od nejhorsi, vrchol se presune ven a hned se
+        // odebere (T nemusi mit vychozi konstruktor)
+        while (const T *top = m_heap.GetTop())
+        {
+            out.push_back(std::move(const_cast<T &>(*top)));
+            m_heap.PopTop();
+        }
+        std::reverse(out.begin() + begin, out.end());
+    }
+
+protected:
+    /**
+     * @brief The Inverted struct
+     * Obracene porovnani, na vrcholu haldy je polozka s nejnizsi prioritou.
+     */
+    struct Inverted {
+        explicit Inverted(const Compare &compare)
+            : compare(compare)
+        {
+        }
+
+        bool operator()(const T &first, const T &second) const
+        {
+            return compare(second, first);
+        }
+
+        Compare compare;    ///< Puvodni porovnani.
+    };
+
+    BasicPriorityQueue<T, Inverted> m_heap; ///< Uchovane polozky, nejhorsi na vrcholu.
+    Compare m_compare;                      ///< Porovnani priorit polozek.
+    size_t m_capacity;                      ///< Nejvetsi pocet polozek.
+};
+
+#endif // BOUNDED_QUEUE_H_
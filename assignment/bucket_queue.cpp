@@ -0,0 +1,254 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - bucket queue for bounded integer priorities
+//
+// $NoKeywords: $ivs_project_1 $bucket_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file bucket_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty pro hodnoty z omezeneho rozsahu.
+ */
+
+#include <stdexcept>
+
+#include "bucket_queue.h"
+
+const size_t BucketPriorityQueue::NONE;
+const size_t BucketPriorityQueue::MAX_RANGE;
+
+namespace {
+
+/**
+ * @brief LowestBit
+ * @return Vraci index nejnizsiho nastaveneho bitu nenuloveho slova "word".
+ */
+inline unsigned LowestBit(uint64_t word)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned index = 0;
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief MaskAbove
+ * @return Vraci masku bitu slova s indexem vetsim nez "bit".
+ */
+inline uint64_t MaskAbove(size_t bit)
+{
+    return (bit & 63) == 63 ? 0 : ~static_cast<uint64_t>(0) << ((bit & 63) + 1);
+}
+
+} // namespace
+
+BucketPriorityQueue::BucketPriorityQueue(int minValue, int maxValue)
+    : m_pHead(nullptr), m_minValue(minValue), m_topBucket(NONE), m_length(0)
+{
+    if (minValue > maxValue)
+        throw std::invalid_argument("Nejmensi hodnota rozsahu je vetsi nez nejvetsi.");
+
+    unsigned long long range = static_cast<unsigned long long>(static_cast<long long>(maxValue) - minValue) + 1;
+    if (range > MAX_RANGE)
+        throw std::invalid_argument("Rozsah fronty obsahuje prilis mnoho hodnot.");
+
+    size_t buckets = static_cast<size_t>(range);
+    m_first.assign(buckets, nullptr);
+    m_last.assign(buckets, nullptr);
+
+    // Urovne bitove mapy az po jedine slovo
+    size_t bits = buckets;
+    do
+    {
+        bits = (bits + 63) / 64;
+        m_levels.push_back(std::vector<uint64_t>(bits, 0));
+    } while (bits > 1);
+}
+
+BucketPriorityQueue::~BucketPriorityQueue()
+{
+    // Polozky uvolni alokator po celych blocich (destruktor m_pool)
+    m_pHead = nullptr;
+}
+
+void BucketPriorityQueue::Insert(int value)
+{
+    size_t bucket = BucketOf(value);
+    if (bucket == NONE)
+        throw std::out_of_range("Hodnota lezi mimo rozsah fronty.");
+
+    Element_t *element = m_pool.Allocate();
+    element->value = value;
+
+    if (m_first[bucket] != nullptr)
+    {
+        // Vkladani za prvni polozku se stejnou hodnotou
+        element->pNext = m_first[bucket]->pNext;
+        m_first[bucket]->pNext = element;
+        if (m_last[bucket] == m_first[bucket])
+            m_last[bucket] = element;
+    }
+    else
+    {
+        // Nove maximum patri na zacatek fronty bez hledani, jinak se vklada
+        // za posledni polozku nejblizsiho vetsiho kose
+        Element_t **link = &m_pHead;
+        if (m_topBucket != NONE && bucket < m_topBucket)
+            link = &m_last[FindHigher(bucket)]->pNext;
+        else
+            m_topBucket = bucket;
+        element->pNext = *link;
+        *link = element;
+        m_first[bucket] = m_last[bucket] = element;
+        SetBit(bucket);
+    }
+    m_length++;
+}
+
+bool BucketPriorityQueue::Remove(int value)
+{
+    size_t bucket = BucketOf(value);
+    if (bucket == NONE || m_first[bucket] == nullptr)
+        return false;
+
+    Element_t *first = m_first[bucket];
+    if (first != m_last[bucket])
+    {
+        // Odstraneni polozky za prvni polozkou kose, predchudce je znamy
+        Element_t *temp = first->pNext;
+        first->pNext = temp->pNext;
+        if (temp == m_last[bucket])
+            m_last[bucket] = first;
+        m_pool.Release(temp);
+    }
+    else
+    {
+        // Posledni polozka kose, predchudcem je zacatek fronty (nejvyssi kos)
+        // nebo posledni polozka vetsiho kose
+        Element_t **link = &m_pHead;
+        if (first != m_pHead)
+            link = &m_last[FindHigher(bucket)]->pNext;
+        *link = first->pNext;
+        m_pool.Release(first);
+        m_first[bucket] = m_last[bucket] = nullptr;
+        ClearBit(bucket);
+
+        // Novym nejvyssim kosem je kos nove prvni polozky
+        if (bucket == m_topBucket)
+            m_topBucket = m_pHead != nullptr ? BucketOf(m_pHead->value) : NONE;
+    }
+    m_length--;
+    return true;
+}
+
+BucketPriorityQueue::Element_t *BucketPriorityQueue::Find(int value)
+{
+    size_t bucket = BucketOf(value);
+    if (bucket == NONE)
+        return nullptr;
+    return m_first[bucket];
+}
+
+size_t BucketPriorityQueue::Length()
+{
+    return m_length;
+}
+
+BucketPriorityQueue::Element_t *BucketPriorityQueue::GetHead()
+{
+    return m_pHead;
+}
+
+bool BucketPriorityQueue::PopTop(int &value)
+{
+    if (m_pHead == nullptr)
+        return false;
+
+    value = m_pHead->value;
+    return Remove(value);
+}
+
+bool BucketPriorityQueue::PopTop()
+{
+    if (m_pHead == nullptr)
+        return false;
+
+    return Remove(m_pHead->value);
+}
+
+size_t BucketPriorityQueue::BucketOf(int value) const
+{
+    long long bucket = static_cast<long long>(value) - m_minValue;
+    if (bucket < 0 || static_cast<unsigned long long>(bucket) >= m_first.size())
+        return NONE;
+    return static_cast<size_t>(bucket);
+}
+
+size_t BucketPriorityQueue::FindHigher(size_t bucket) const
+{
+    // Stoupani, dokud slovo nema nastaveny bit nad aktualni pozici
+    size_t index = bucket;
+    size_t level = 0;
+    for (;;)
+    {
+        if (level == m_levels.size())
+            return NONE;
+        uint64_t mask = m_levels[level][index / 64] & MaskAbove(index);
+        if (mask != 0)
+        {
+            index = index / 64 * 64 + LowestBit(mask);
+            break;
+        }
+        index /= 64;
+        level++;
+    }
+
+    // Sestup k nejnizsimu neprazdnemu kosi pod nalezenym bitem
+    while (level > 0)
+    {
+        level--;
+        index = index * 64 + LowestBit(m_levels[level][index]);
+    }
+    return index;
+}
+
+void BucketPriorityQueue::SetBit(size_t bucket)
+{
+    // Vyssi urovne se meni, jen pokud bylo slovo dosud nulove
+    size_t index = bucket;
+    for (size_t level = 0; level < m_levels.size(); level++)
+    {
+        uint64_t &word = m_levels[level][index / 64];
+        bool wasEmpty = word == 0;
+        word |= static_cast<uint64_t>(1) << (index % 64);
+        if (!wasEmpty)
+            break;
+        index /= 64;
+    }
+}
+
+void BucketPriorityQueue::ClearBit(size_t bucket)
+{
+    // Vyssi urovne se meni, jen pokud slovo zustalo nulove
+    size_t index = bucket;
+    for (size_t level = 0; level < m_levels.size(); level++)
+    {
+        uint64_t &word = m_levels[level][index / 64];
+        word &= ~(static_cast<uint64_t>(1) << (index % 64));
+        if (word != 0)
+            break;
+        index /= 64;
+    }
+}
+
+/*** Konec souboru bucket_queue.cpp ***/
@@ -0,0 +1,180 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - bucket queue for bounded integer priorities
+//
+// $NoKeywords: $ivs_project_1 $bucket_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file bucket_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty pro hodnoty z omezeneho rozsahu.
+ */
+
+#pragma once
+
+#ifndef BUCKET_QUEUE_H_
+#define BUCKET_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "slab_pool.h"
+#include "tdd_code.h"
+
+/**
+ * @brief The BucketPriorityQueue class
+ * Prioritni fronta (polozky vzdy serazeny od max po min) pro hodnoty z rozsahu
+ * zadaneho pri vytvoreni fronty. Polozky tvori stejny serazeny seznam jako v
+ * PriorityQueue (GetHead() a pNext), navic ma kazda hodnota z rozsahu svuj
+ * kos s odkazy na prvni a posledni polozku s touto hodnotou. Neprazdne kose
+ * jsou oznaceny v hierarchicke bitove mape: kazda uroven ma bit pro kazde
+ * nenulove 64bitove slovo urovne pod ni a nejvyssi uroven je jedine slovo.
+ * Nejblizsi vetsi neprazdny kos se najde nejvyse dvema pruchody urovnemi
+ * (jedno slovo na kazde urovni), tj. pro MAX_RANGE nejvyse 4 slova nahoru
+ * a 3 dolu.
+ *
+ * Insert a Remove maji slozitost O(log64 r), kde r je velikost rozsahu, Find
+ * a PopTop nejvyssi hodnoty v kosi s vice polozkami O(1). Nezavisi tedy na
+ * delce fronty ani na vzdalenosti sousednich hodnot. Pamet je umerna velikosti
+ * rozsahu: dva ukazatele na kazdou hodnotu (16 B na 64bitovem systemu) a
+ * priblizne 1/8 B na bitovou mapu. Rozsah je proto omezen na MAX_RANGE hodnot
+ * (256 MiB poli kosu), vetsi rozsahy (napr. cele casove razitko) konstruktor
+ * odmitne.
+ */
+class BucketPriorityQueue
+{
+public:
+    typedef PriorityQueue::Element_t Element_t;
+
+    /**
+     * @brief Nejvetsi pocet hodnot v rozsahu fronty.
+     */
+    static const size_t MAX_RANGE = static_cast<size_t>(1) << 24;
+
+    /**
+     * @brief BucketPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu pro hodnoty z rozsahu
+     * <minValue, maxValue>.
+     * @param minValue Nejmensi hodnota, kterou lze vlozit.
+     * @param maxValue Nejvetsi hodnota, kterou lze vlozit.
+     * @throw std::invalid_argument Pokud je minValue > maxValue nebo rozsah
+     * obsahuje vice nez MAX_RANGE hodnot.
+     */
+    BucketPriorityQueue(int minValue, int maxValue);
+
+    /**
+     * @brief ~BucketPriorityQueue
+     * Destruktor, odstrani vsechny polozky i frontu samotnou.
+     */
+    ~BucketPriorityQueue();
+
+    BucketPriorityQueue(const BucketPriorityQueue &) = delete;
+    BucketPriorityQueue &operator=(const BucketPriorityQueue &) = delete;
+
+    /**
+     * @brief Insert
+     * Zaradi novou polozku s hodnotou "value" do fronty na patricne misto (tak
+     * aby bylo zachovano poradi max->min). Slozitost O(log64 r).
+     * @param value Hodnota nove polozky.
+     * @throw std::out_of_range Pokud hodnota nelezi v rozsahu fronty.
+     */
+    void Insert(int value);
+
+    /**
+     * @brief Remove
+     * Odstrani polozku s hodnotou "value" z fronty a vrati "true", pokud polozka
+     * neni nalezena vrati "false". Slozitost O(log64 r).
+     * @param value Hodnota polozky, ktera ma byt odstranena.
+     * @return Vrati true, pokud byla polozka nalezena a odstranena, jinak vraci false.
+     */
+    bool Remove(int value);
+
+    /**
+     * @brief Find
+     * Nalezne prvni polozku s hodnotou "value". Slozitost O(1).
+     * @param value Hodnota hledane polozky.
+     * @return Vrati ukazatel na polozku s hodnotou "value", nebo NULL pokud takova neexistuje.
+     */
+    Element_t *Find(int value);
+
+    /**
+     * @brief Length
+     * Vraci delku fronty. Delka prazdne fronty je 0.
+     * @return Vrati delku fronty.
+     */
+    size_t Length();
+
+    /**
+     * @brief GetHead
+     * Vraci ukazatel na prvni polozku ve fronte, ktera je vzdy zaroven polozkou
+     * s nejvetsi hodnotou.
+     * @return Vraci ukazatel na 1./nejvetsi polozku fronty, nebo NULL, pokud je
+     * fronta prazdna.
+     */
+    Element_t *GetHead();
+
+    /**
+     * @brief PopTop
+     * Odstrani z fronty polozku s nejvetsi hodnotou. Slozitost O(log64 r),
+     * pokud se vyprazdni kos, jinak O(1).
+     * @param value Vystupni parametr, do ktereho se ulozi hodnota odstranene
+     * polozky.
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopTop(int &value);
+
+    /**
+     * @brief PopTop
+     * Odstrani z fronty polozku s nejvetsi hodnotou. Slozitost O(log64 r),
+     * pokud se vyprazdni kos, jinak O(1).
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopTop();
+
+protected:
+    /**
+     * @brief Index "zadneho" kose.
+     */
+    static const size_t NONE = static_cast<size_t>(-1);
+
+    /**
+     * @brief BucketOf
+     * Prevede hodnotu na index kose.
+     * @return Vraci index kose, nebo NONE, pokud hodnota nelezi v rozsahu.
+     */
+    size_t BucketOf(int value) const;
+
+    /**
+     * @brief FindHigher
+     * Nalezne nejblizsi neprazdny kos s vetsi hodnotou nez kos "bucket".
+     * Hledani stoupa urovnemi bitove mapy, dokud ve slove nenajde vyssi
+     * nastaveny bit, a pak sestupuje k nejnizsimu nastavenemu bitu; na kazde
+     * urovni cte jedine slovo.
+     * @return Vraci index kose, nebo NONE, pokud takovy neexistuje.
+     */
+    size_t FindHigher(size_t bucket) const;
+
+    void SetBit(size_t bucket);
+    void ClearBit(size_t bucket);
+
+    Element_t *m_pHead;                 ///< Ukazatel na zacatek fronty.
+    int m_minValue;                     ///< Nejmensi hodnota rozsahu.
+    size_t m_topBucket;                 ///< Nejvyssi neprazdny kos, nebo NONE.
+    size_t m_length;                    ///< Pocet polozek ve fronte.
+    std::vector<Element_t *> m_first;   ///< Prvni polozka kazdeho kose.
+    std::vector<Element_t *> m_last;    ///< Posledni polozka kazdeho kose.
+    /**
+     * Urovne bitove mapy. Uroven 0 ma bit pro kazdy neprazdny kos, kazda dalsi
+     * bit pro kazde nenulove slovo predchozi urovne, posledni uroven je jedine
+     * slovo.
+     */
+    std::vector<std::vector<uint64_t> > m_levels;
+    SlabPool<Element_t> m_pool;         ///< Alokator polozek fronty.
+};
+
+#endif // BUCKET_QUEUE_H_
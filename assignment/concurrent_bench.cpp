@@ -0,0 +1,160 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - concurrent throughput benchmark
+//
+// $NoKeywords: $ivs_project_1 $concurrent_bench.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file concurrent_bench.cpp
+ * @author Hung Do
+ *
+ * @brief Mereni propustnosti soubezne prioritni fronty v zavislosti na poctu
+ * vlaken (lock-free fronta a relaxovana MultiQueue vs. halda chranena jednim
+ * zamkem).
+ *
+ * Zrychleni s poctem vlaken ma vypovidajici hodnotu jen na stroji s vice
+ * jadry; na jednom jadru se vlakna pouze stridaji a program na to upozorni.
+ *
+ * Pouziti: concurrent_bench [pocet operaci na vlakno] [max. pocet vlaken]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "concurrent_queue.h"
+#include "heap_queue.h"
+#include "multi_queue.h"
+
+namespace {
+
+/**
+ * Pocet polozek vlozenych do fronty pred zacatkem mereni.
+ */
+const int PREFILL = 10000;
+
+/**
+ * @brief The LockedHeap class
+ * Halda chranena jednim zamkem, reference pro porovnani.
+ */
+class LockedHeap
+{
+public:
+    void Insert(int value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_heap.Insert(value);
+    }
+
+    bool PopMax(int &value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_heap.PopTop(value);
+    }
+
+private:
+    std::mutex m_mutex;
+    HeapPriorityQueue m_heap;
+};
+
+/**
+ * @brief The RelaxedQueue class
+ * MultiQueue s dilcimi frontami pro vsechna jadra procesoru.
+ */
+class RelaxedQueue : public MultiQueue
+{
+public:
+    RelaxedQueue()
+        : MultiQueue(std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1)
+    {
+    }
+};
+
+/**
+ * @brief Run
+ * Spusti "threads" vlaken, kazde provede "operations" dvojic Insert/PopMax.
+ * @return Vrati propustnost v milionech operaci za sekundu.
+ */
+template <typename Queue>
+double Run(unsigned threads, long operations)
+{
+    Queue queue;
+    for (int i = 0; i < PREFILL; i++)
+        queue.Insert((i * 7919) % PREFILL);
+
+    std::atomic<unsigned> ready(0);
+    std::atomic<bool> start(false);
+    std::vector<std::thread> workers;
+
+    for (unsigned t = 0; t < threads; t++)
+    {
+        workers.push_back(std::thread([&, t]() {
+            unsigned seed = 12345 + t;
+            int value;
+            ready++;
+            // Cekani na spusteni vsech vlaken, procesor se mezitim uvolni
+            while (!start.load())
+                std::this_thread::yield();
+            for (long i = 0; i < operations; i++)
+            {
+                seed = seed * 1103515245 + 12345;
+                queue.Insert(static_cast<int>(seed >> 8));
+                queue.PopMax(value);
+            }
+        }));
+    }
+
+    while (ready.load() != threads)
+        std::this_thread::yield();
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    start.store(true);
+    for (unsigned t = 0; t < threads; t++)
+        workers[t].join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+    return 2.0 * operations * threads / elapsed.count() / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    long operations = argc > 1 ? atol(argv[1]) : 200000;
+    unsigned maxThreads = argc > 2 ? static_cast<unsigned>(atoi(argv[2]))
+                                   : std::thread::hardware_concurrency();
+    if (maxThreads < 1)
+        maxThreads = 1;
+    if (std::thread::hardware_concurrency() < 2)
+        fprintf(stderr, "upozorneni: jediny procesor, skalovani s poctem vlaken nelze overit\n");
+
+    // Mocniny dvou a nakonec maximalni pocet vlaken
+    std::vector<unsigned> counts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2)
+        counts.push_back(threads);
+    counts.push_back(maxThreads);
+
+    printf("%8s %16s %16s %16s %10s\n", "threads", "lock-free Mops/s", "multiq Mops/s",
+           "mutex Mops/s", "speedup");
+    double base = 0.0;
+    for (size_t i = 0; i < counts.size(); i++)
+    {
+        double lockFree = Run<ConcurrentPriorityQueue>(counts[i], operations);
+        double relaxed = Run<RelaxedQueue>(counts[i], operations);
+        double locked = Run<LockedHeap>(counts[i], operations);
+        if (i == 0)
+            base = lockFree;
+        printf("%8u %16.2f %16.2f %16.2f %9.2fx\n", counts[i], lockFree, relaxed, locked,
+               lockFree / base);
+    }
+    return 0;
+}
+
+/*** Konec souboru concurrent_bench.cpp ***/
@@ -0,0 +1,349 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - lock-free concurrent skip list
+//
+// $NoKeywords: $ivs_project_1 $concurrent_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file concurrent_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty pro soubezny pristup vice vlaken.
+ */
+
+#include <stdlib.h>
+
+#include <new>
+#include <stdexcept>
+
+#include "concurrent_queue.h"
+
+const unsigned ConcurrentPriorityQueue::MAX_LEVEL;
+const unsigned ConcurrentPriorityQueue::MAX_THREADS;
+const size_t ConcurrentPriorityQueue::BOUND_OFFSET;
+
+namespace {
+
+/**
+ * Po kolika odpojenych polozkach se vlakno pokusi posunout globalni epochu.
+ */
+const unsigned long ADVANCE_INTERVAL = 64;
+
+/**
+ * Obsazene indexy vlaken (spolecne pro vsechny fronty).
+ */
+std::atomic<bool> g_aSlotUsed[ConcurrentPriorityQueue::MAX_THREADS];
+
+/**
+ * @brief The ThreadSlot_t struct
+ * Index vlakna, ktery vlakno ziska pri prvnim pouziti fronty a uvolni pri
+ * svem ukonceni.
+ */
+struct ThreadSlot_t {
+    unsigned index;
+
+    ThreadSlot_t()
+    {
+        for (index = 0; index < ConcurrentPriorityQueue::MAX_THREADS; index++)
+        {
+            if (!g_aSlotUsed[index].exchange(true))
+                return;
+        }
+        throw std::runtime_error("Prilis mnoho soubeznych vlaken.");
+    }
+
+    ~ThreadSlot_t()
+    {
+        g_aSlotUsed[index].store(false);
+    }
+};
+
+unsigned ThreadIndex()
+{
+    static thread_local ThreadSlot_t slot;
+    return slot.index;
+}
+
+} // namespace
+
+ConcurrentPriorityQueue::Guard::Guard(ConcurrentPriorityQueue &queue)
+    : state(queue.m_aThreads[ThreadIndex()])
+{
+    state.epoch.store((queue.m_epoch.load() << 1) | 1);
+}
+
+ConcurrentPriorityQueue::Guard::~Guard()
+{
+    state.epoch.store(0);
+}
+
+ConcurrentPriorityQueue::ConcurrentPriorityQueue()
+    : m_pHead(AllocNode(MAX_LEVEL, 0)), m_pTail(AllocNode(MAX_LEVEL, 0)), m_epoch(0)
+{
+    for (unsigned i = 0; i < MAX_LEVEL; i++)
+        m_pHead->next[i].store(Link(m_pTail));
+
+    for (unsigned i = 0; i < MAX_THREADS; i++)
+    {
+        m_aThreads[i].epoch.store(0);
+        for (unsigned j = 0; j < 3; j++)
+            m_aThreads[i].limboEpoch[j] = 0;
+        m_aThreads[i].retired = 0;
+        m_aThreads[i].seed = 2463534242u + i * 2654435761u;
+    }
+}
+
+ConcurrentPriorityQueue::~ConcurrentPriorityQueue()
+{
+    // Vsechny polozky, ktere nejsou odpojene, jsou dosazitelne v urovni 0
+    Node_t *node = m_pHead;
+    while (node != m_pTail)
+    {
+        Node_t *temp = Unmark(node->next[0].load());
+        FreeNode(node);
+        node = temp;
+    }
+    FreeNode(m_pTail);
+
+    for (unsigned i = 0; i < MAX_THREADS; i++)
+    {
+        for (unsigned j = 0; j < 3; j++)
+        {
+            for (size_t k = 0; k < m_aThreads[i].limbo[j].size(); k++)
+                FreeNode(m_aThreads[i].limbo[j][k]);
+        }
+    }
+}
+
+void ConcurrentPriorityQueue::Insert(int value)
+{
+    Guard guard(*this);
+
+    unsigned level = RandomLevel(guard.state);
+    Node_t *node = AllocNode(level, value);
+    node->inserting.store(true);
+
+    Node_t *preds[MAX_LEVEL];
+    Node_t *succs[MAX_LEVEL];
+    Node_t *del;
+
+    // Zarazeni do urovne 0 (linearizacni bod vkladani), CAS selze, pokud je
+    // odkaz predchudce mezitim zmenen nebo oznacen
+    for (;;)
+    {
+        del = LocatePreds(value, preds, succs);
+        node->next[0].store(Link(succs[0]));
+        uintptr_t expected = Link(succs[0]);
+        if (preds[0]->next[0].compare_exchange_strong(expected, Link(node)))
+            break;
+    }
+
+    // Zarazeni do vyssich urovni, prerusi se, pokud je polozka nebo jeji
+    // naslednik mezitim odstranen
+    unsigned i = 1;
+    while (i < level)
+    {
+        node->next[i].store(Link(succs[i]));
+        if (IsMarked(node->next[0].load()) || IsMarked(succs[i]->next[0].load()) ||
+            del == succs[i])
+            break;
+
+        uintptr_t expected = Link(succs[i]);
+        if (preds[i]->next[i].compare_exchange_strong(expected, Link(node)))
+            i++;
+        else
+        {
+            del = LocatePreds(value, preds, succs);
+            if (succs[0] != node)
+                break;
+        }
+    }
+
+    node->inserting.store(false);
+}
+
+bool ConcurrentPriorityQueue::PopMax(int &value)
+{
+    Guard guard(*this);
+
+    Node_t *x = m_pHead;
+    Node_t *newHead = nullptr;
+    size_t offset = 0;
+    uintptr_t obsHead = m_pHead->next[0].load();
+    uintptr_t next;
+
+    // Pruchod logicky odstranenymi polozkami, prvni polozka, jejiz odkaz
+    // predchudce se podari oznacit jako prvni, patri tomuto vlaknu
+    do
+    {
+        next = x->next[0].load();
+        if (Unmark(next) == m_pTail)
+            return false;
+        if (newHead == nullptr && x->inserting.load())
+            newHead = x;
+        next = x->next[0].fetch_or(1);
+        offset++;
+        x = Unmark(next);
+    } while (IsMarked(next));
+
+    value = x->value;
+    if (newHead == nullptr)
+        newHead = x;
+
+    // Fyzicke odpojeni odstranenych polozek az do "newHead"
+    if (offset >= BOUND_OFFSET &&
+        m_pHead->next[0].compare_exchange_strong(obsHead, Link(newHead) | 1))
+    {
+        Restructure();
+        Node_t *curr = Unmark(obsHead);
+        while (curr != newHead)
+        {
+            Node_t *temp = Unmark(curr->next[0].load());
+            Retire(guard.state, curr);
+            curr = temp;
+        }
+    }
+    return true;
+}
+
+size_t ConcurrentPriorityQueue::Length() const
+{
+    size_t length = 0;
+    Node_t *node = m_pHead;
+    while (node != m_pTail)
+    {
+        uintptr_t next = node->next[0].load();
+        node = Unmark(next);
+        if (!IsMarked(next) && node != m_pTail)
+            length++;
+    }
+    return length;
+}
+
+ConcurrentPriorityQueue::Node_t *ConcurrentPriorityQueue::AllocNode(unsigned level, int value)
+{
+    size_t size = sizeof(Node_t) + (level - 1) * sizeof(std::atomic<uintptr_t>);
+    void *memory = malloc(size);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+
+    Node_t *node = static_cast<Node_t *>(memory);
+    node->value = value;
+    node->level = level;
+    new (&node->inserting) std::atomic<bool>(false);
+    for (unsigned i = 0; i < level; i++)
+        new (&node->next[i]) std::atomic<uintptr_t>(0);
+    return node;
+}
+
+void ConcurrentPriorityQueue::FreeNode(Node_t *node)
+{
+    free(node);
+}
+
+ConcurrentPriorityQueue::Node_t *ConcurrentPriorityQueue::LocatePreds(int value, Node_t **preds, Node_t **succs)
+{
+    Node_t *del = nullptr;
+    Node_t *x = m_pHead;
+
+    for (unsigned i = MAX_LEVEL; i-- > 0;)
+    {
+        uintptr_t next = x->next[i].load();
+        bool deleted = IsMarked(next);
+        Node_t *xNext = Unmark(next);
+
+        while ((xNext != m_pTail && xNext->value > value) ||
+               IsMarked(xNext->next[0].load()) || (i == 0 && deleted))
+        {
+            if (i == 0 && deleted)
+                del = xNext;
+            x = xNext;
+            next = x->next[i].load();
+            deleted = IsMarked(next);
+            xNext = Unmark(next);
+        }
+
+        preds[i] = x;
+        succs[i] = xNext;
+    }
+    return del;
+}
+
+void ConcurrentPriorityQueue::Restructure()
+{
+    unsigned i = MAX_LEVEL - 1;
+    Node_t *pred = m_pHead;
+
+    while (i > 0)
+    {
+        uintptr_t head = m_pHead->next[i].load();
+        Node_t *curr = Unmark(pred->next[i].load());
+        if (!IsMarked(Unmark(head)->next[0].load()))
+        {
+            i--;
+            continue;
+        }
+
+        while (IsMarked(curr->next[0].load()))
+        {
+            pred = curr;
+            curr = Unmark(pred->next[i].load());
+        }
+
+        if (m_pHead->next[i].compare_exchange_strong(head, pred->next[i].load()))
+            i--;
+    }
+}
+
+void ConcurrentPriorityQueue::Retire(ThreadState_t &state, Node_t *node)
+{
+    // Polozka odpojena v epose "epoch" muze byt jeste pouzivana vlakny
+    // aktivnimi v epose "epoch", uvolnit ji lze az v epose "epoch + 2";
+    // v kazdem kosi jsou polozky se stejnou epochou modulo 3
+    unsigned long epoch = m_epoch.load();
+    unsigned bin = epoch % 3;
+    if (state.limboEpoch[bin] != epoch)
+    {
+        for (size_t k = 0; k < state.limbo[bin].size(); k++)
+            FreeNode(state.limbo[bin][k]);
+        state.limbo[bin].clear();
+        state.limboEpoch[bin] = epoch;
+    }
+    state.limbo[bin].push_back(node);
+
+    if (++state.retired % ADVANCE_INTERVAL == 0)
+        TryAdvanceEpoch();
+}
+
+void ConcurrentPriorityQueue::TryAdvanceEpoch()
+{
+    unsigned long epoch = m_epoch.load();
+    for (unsigned i = 0; i < MAX_THREADS; i++)
+    {
+        unsigned long announced = m_aThreads[i].epoch.load();
+        if ((announced & 1) != 0 && (announced >> 1) != epoch)
+            return;
+    }
+    m_epoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+unsigned ConcurrentPriorityQueue::RandomLevel(ThreadState_t &state)
+{
+    // xorshift32, kazda dalsi uroven s pravdepodobnosti 1/2
+    state.seed ^= state.seed << 13;
+    state.seed ^= state.seed >> 17;
+    state.seed ^= state.seed << 5;
+
+    unsigned level = 1;
+    uint32_t bits = state.seed;
+    while (level < MAX_LEVEL && (bits & 1) != 0)
+    {
+        level++;
+        bits >>= 1;
+    }
+    return level;
+}
+
+/*** Konec souboru concurrent_queue.cpp ***/
@@ -0,0 +1,183 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - lock-free concurrent skip list
+//
+// $NoKeywords: $ivs_project_1 $concurrent_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file concurrent_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty pro soubezny pristup vice vlaken.
+ */
+
+#pragma once
+
+#ifndef CONCURRENT_QUEUE_H_
+#define CONCURRENT_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+/**
+ * @brief The ConcurrentPriorityQueue class
+ * Prioritni fronta bez zamku (lock-free) pro vice producentu a konzumentu.
+ * Fronta je skip list podle Lindena a Jonssona ("A Skiplist-Based Concurrent
+ * Priority Queue with Minimal Memory Contention", 2013): polozka je logicky
+ * odstranena oznacenim (nejnizsim bitem) odkazu jejiho predchudce v nejnizsi
+ * urovni, odstranene polozky tak tvori souvisly zacatek seznamu, ktery se
+ * fyzicky odpojuje az po dosazeni meze BOUND_OFFSET jedinou operaci CAS.
+ * Odpojene polozky se uvolnuji pomoci tzv. epoch-based reclamation, takze
+ * zadne vlakno nepristupuje k uvolnene pameti.
+ */
+class ConcurrentPriorityQueue
+{
+public:
+    /**
+     * @brief Maximalni pocet urovni skip listu.
+     */
+    static const unsigned MAX_LEVEL = 24;
+
+    /**
+     * @brief Maximalni pocet soucasne existujicich vlaken, ktera pracuji s
+     * frontami tohoto typu.
+     */
+    static const unsigned MAX_THREADS = 128;
+
+    /**
+     * @brief Pocet logicky odstranenych polozek na zacatku seznamu, po jehoz
+     * dosazeni se polozky fyzicky odpoji.
+     */
+    static const size_t BOUND_OFFSET = 32;
+
+    /**
+     * @brief ConcurrentPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu.
+     */
+    ConcurrentPriorityQueue();
+
+    /**
+     * @brief ~ConcurrentPriorityQueue
+     * Destruktor, odstrani vsechny polozky i frontu samotnou. Zadne jine
+     * vlakno uz nesmi s frontou pracovat.
+     */
+    ~ConcurrentPriorityQueue();
+
+    ConcurrentPriorityQueue(const ConcurrentPriorityQueue &) = delete;
+    ConcurrentPriorityQueue &operator=(const ConcurrentPriorityQueue &) = delete;
+
+    /**
+     * @brief Insert
+     * Zaradi novou polozku s hodnotou "value" do fronty. Lze volat soubezne
+     * z vice vlaken.
+     * @param value Hodnota nove polozky.
+     */
+    void Insert(int value);
+
+    /**
+     * @brief PopMax
+     * Odstrani z fronty polozku s nejvetsi hodnotou. Lze volat soubezne z vice
+     * vlaken.
+     * @param value Vystupni parametr, do ktereho se ulozi hodnota odstranene
+     * polozky.
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopMax(int &value);
+
+    /**
+     * @brief Length
+     * Vraci delku fronty. Vysledek je presny jen pokud s frontou soucasne
+     * nepracuje jine vlakno.
+     * @return Vrati delku fronty.
+     */
+    size_t Length() const;
+
+protected:
+    /**
+     * @brief The Node_t struct
+     * Polozka skip listu. Pole odkazu se alokuje v potrebne delce spolu s
+     * polozkou, nejnizsi bit odkazu v urovni 0 oznacuje, ze nasledujici
+     * polozka je logicky odstranena.
+     */
+    struct Node_t {
+        int value;                      ///< Hodnota polozky.
+        unsigned level;                 ///< Pocet urovni polozky.
+        std::atomic<bool> inserting;    ///< Polozka se prave zarazuje.
+
+        std::atomic<uintptr_t> next[1]; ///< Odkazy v urovnich 0 az level - 1.
+    };
+
+    /**
+     * @brief The ThreadState_t struct
+     * Stav jednoho vlakna pro uvolnovani pameti pomoci epoch.
+     */
+    struct ThreadState_t {
+        std::atomic<unsigned long> epoch;   ///< Ohlasena epocha (bit 0 = aktivni).
+        std::vector<Node_t *> limbo[3];     ///< Odpojene polozky podle epochy.
+        unsigned long limboEpoch[3];        ///< Epocha polozek v limbo.
+        unsigned long retired;              ///< Pocet odpojenych polozek.
+        uint32_t seed;                      ///< Stav generatoru urovni.
+        char padding[64];                   ///< Oddeleni od stavu dalsiho vlakna.
+    };
+
+    /**
+     * @brief The Guard class
+     * Po dobu sve existence oznacuje vlakno jako aktivni v aktualni epose.
+     */
+    class Guard
+    {
+    public:
+        explicit Guard(ConcurrentPriorityQueue &queue);
+        ~Guard();
+
+        ThreadState_t &state;   ///< Stav aktualniho vlakna.
+    };
+
+    static Node_t *AllocNode(unsigned level, int value);
+    static void FreeNode(Node_t *node);
+
+    static bool IsMarked(uintptr_t link) { return (link & 1) != 0; }
+    static Node_t *Unmark(uintptr_t link) { return reinterpret_cast<Node_t *>(link & ~static_cast<uintptr_t>(1)); }
+    static uintptr_t Link(Node_t *node) { return reinterpret_cast<uintptr_t>(node); }
+
+    /**
+     * @brief LocatePreds
+     * Pro kazdou uroven nalezne posledni polozku pred mistem pro hodnotu
+     * "value" (preskakuje logicky odstranene polozky) a jejiho naslednika.
+     * @return Vrati posledni logicky odstranenou polozku nalezenou v urovni 0.
+     */
+    Node_t *LocatePreds(int value, Node_t **preds, Node_t **succs);
+
+    /**
+     * @brief Restructure
+     * Posune odkazy hlavicky ve vyssich urovnich za logicky odstranene polozky.
+     */
+    void Restructure();
+
+    /**
+     * @brief Retire
+     * Preda odpojenou polozku k uvolneni, az ji nebude moci pouzivat zadne
+     * vlakno.
+     */
+    void Retire(ThreadState_t &state, Node_t *node);
+
+    /**
+     * @brief TryAdvanceEpoch
+     * Posune globalni epochu, pokud vsechna aktivni vlakna ohlasila aktualni.
+     */
+    void TryAdvanceEpoch();
+
+    unsigned RandomLevel(ThreadState_t &state);
+
+    Node_t *m_pHead;                    ///< Hlavicka seznamu (bez hodnoty).
+    Node_t *m_pTail;                    ///< Zarazka na konci seznamu.
+    std::atomic<unsigned long> m_epoch; ///< Globalni epocha.
+    ThreadState_t m_aThreads[MAX_THREADS]; ///< Stavy vlaken podle indexu vlakna.
+};
+
+#endif // CONCURRENT_QUEUE_H_
@@ -0,0 +1,251 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - external-memory queue with sorted runs on disk
+//
+// $NoKeywords: $ivs_project_1 $external_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file external_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty, ktera pri prekroceni
+ * pametoveho limitu odklada polozky do docasnych souboru.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "external_queue.h"
+
+const size_t ExternalPriorityQueue::DEFAULT_BLOCK_SIZE;
+const size_t ExternalPriorityQueue::NONE;
+
+ExternalPriorityQueue::ExternalPriorityQueue(size_t memoryBudget, size_t blockSize)
+    : m_heapCapacity(0), m_blockItems(blockSize / sizeof(int)), m_maxRuns(0),
+      m_activeRuns(0), m_length(0)
+{
+    size_t blocks = blockSize >= sizeof(int) ? memoryBudget / 2 / blockSize : 0;
+    if (blocks < 4)
+        throw std::invalid_argument("Pametovy limit je pro zadanou velikost bloku prilis maly.");
+
+    // Polovina limitu pripada halde (bez bloku pro zapis), druha polovina
+    // blokum behu vcetne dvou behu navic pri zapisu a slucovani
+    m_heapCapacity = (memoryBudget / 2 - blockSize) / sizeof(int);
+    m_maxRuns = blocks - 2;
+    m_heap = BasicPriorityQueue<int>(m_heapCapacity);
+    m_block.reserve(m_blockItems);
+}
+
+ExternalPriorityQueue::~ExternalPriorityQueue()
+{
+    for (size_t i = 0; i < m_runs.size(); i++)
+    {
+        if (m_runs[i].pFile != nullptr)
+            fclose(m_runs[i].pFile);
+    }
+}
+
+bool ExternalPriorityQueue::Insert(int value)
+{
+    if (m_heap.Length() >= m_heapCapacity)
+    {
+        Spill();
+        if (m_activeRuns > m_maxRuns)
+            Compact();
+        if (m_heap.Length() >= m_heapCapacity)
+            return false;
+    }
+
+    m_heap.Insert(value);
+    m_length++;
+    return true;
+}
+
+const int *ExternalPriorityQueue::GetTop() const
+{
+    const int *top = m_heap.GetTop();
+    const Head_t *head = m_merge.GetTop();
+    if (head != nullptr && (top == nullptr || head->value > *top))
+        return &head->value;
+    return top;
+}
+
+bool ExternalPriorityQueue::PopTop(int &value)
+{
+    const int *top = m_heap.GetTop();
+    const Head_t *head = m_merge.GetTop();
+    if (head != nullptr && (top == nullptr || head->value > *top))
+    {
+        int result = head->value;
+        if (!Advance(head->run))
+            return false;
+        value = result;
+    }
+    else if (!m_heap.PopTop(value))
+        return false;
+
+    m_length--;
+    return true;
+}
+
+size_t ExternalPriorityQueue::Length() const
+{
+    return m_length;
+}
+
+size_t ExternalPriorityQueue::RunCount() const
+{
+    return m_activeRuns;
+}
+
+size_t ExternalPriorityQueue::NewRun()
+{
+    FILE *file = tmpfile();
+    if (file == nullptr)
+        return NONE;
+
+    // Cte a zapisuje se po celych blocich, vlastni buffer souboru je zbytecny
+    setvbuf(file, nullptr, _IONBF, 0);
+
+    size_t index = 0;
+    while (index < m_runs.size() && !m_runs[index].buffer.empty())
+        index++;
+    if (index == m_runs.size())
+        m_runs.push_back(Run_t());
+
+    Run_t &run = m_runs[index];
+    run.pFile = file;
+    run.remaining = 0;
+    run.pos = 0;
+    run.buffer.reserve(m_blockItems);
+    return index;
+}
+
+bool ExternalPriorityQueue::Append(size_t index, int value)
+{
+    Run_t &run = m_runs[index];
+    if (run.buffer.size() < m_blockItems)
+    {
+        run.buffer.push_back(value);
+        return true;
+    }
+
+    m_block.push_back(value);
+    return m_block.size() < m_blockItems || Flush(run);
+}
+
+bool ExternalPriorityQueue::Flush(Run_t &run)
+{
+    size_t written = fwrite(m_block.data(), sizeof(int), m_block.size(), run.pFile);
+    run.remaining += written;
+    m_block.erase(m_block.begin(), m_block.begin() + written);
+    return m_block.empty();
+}
+
+void ExternalPriorityQueue::Finish(size_t index)
+{
+    Run_t &run = m_runs[index];
+    if (!m_block.empty() && !Flush(run))
+    {
+        for (size_t i = 0; i < m_block.size(); i++)
+            m_heap.Insert(m_block[i]);
+        m_block.clear();
+    }
+
+    if (run.remaining == 0)
+    {
+        fclose(run.pFile);
+        run.pFile = nullptr;
+    }
+    else
+        rewind(run.pFile);
+
+    if (run.buffer.empty())
+        return;
+
+    Head_t head = { run.buffer[0], index };
+    m_merge.Insert(head);
+    m_activeRuns++;
+}
+
+void ExternalPriorityQueue::Spill()
+{
+    size_t index = NewRun();
+    if (index == NONE)
+        return;
+
+    // Halda vydava hodnoty od nejvetsi, beh je tedy serazeny
+    int value;
+    while (m_heap.PopTop(value) && Append(index, value))
+        ;       // zamerne prazdne telo
+    Finish(index);
+}
+
+void ExternalPriorityQueue::Compact()
+{
+    size_t index = NewRun();
+    if (index == NONE)
+        return;
+
+    while (const Head_t *top = m_merge.GetTop())
+    {
+        Head_t head = *top;
+        if (!Advance(head.run) || !Append(index, head.value))
+            break;
+    }
+    Finish(index);
+}
+
+bool ExternalPriorityQueue::Advance(size_t index)
+{
+    Run_t &run = m_runs[index];
+    if (run.pos + 1 < run.buffer.size())
+        run.pos++;
+    else if (run.remaining > 0)
+    {
+        if (!Refill(run))
+            return false;
+    }
+    else
+    {
+        // Beh je precteny, jeho misto se uvolni
+        m_merge.PopTop();
+        run.buffer.clear();
+        run.pos = 0;
+        m_activeRuns--;
+        return true;
+    }
+
+    Head_t head = { run.buffer[run.pos], index };
+    m_merge.ReplaceTop(head);
+    return true;
+}
+
+bool ExternalPriorityQueue::Refill(Run_t &run)
+{
+    // Soubor se zapisuje az po zaplneni prvniho bloku, buffer tedy ma
+    // velikost celeho bloku
+    size_t count = std::min(run.remaining, m_blockItems);
+    size_t read = fread(run.buffer.data(), sizeof(int), count, run.pFile);
+    if (read < count)
+    {
+        // Vraceni pozice souboru, posledni hodnota bloku zustava neprepsana
+        clearerr(run.pFile);
+        fseek(run.pFile, -static_cast<long>(read * sizeof(int)), SEEK_CUR);
+        return false;
+    }
+
+    run.buffer.resize(count);
+    run.remaining -= count;
+    run.pos = 0;
+    if (run.remaining == 0)
+    {
+        fclose(run.pFile);
+        run.pFile = nullptr;
+    }
+    return true;
+}
+
+/*** Konec souboru external_queue.cpp ***/
@@ -0,0 +1,210 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - external-memory queue with sorted runs on disk
+//
+// $NoKeywords: $ivs_project_1 $external_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file external_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty, ktera pri prekroceni pametoveho
+ * limitu odklada polozky do docasnych souboru.
+ */
+
+#pragma once
+
+#ifndef EXTERNAL_QUEUE_H_
+#define EXTERNAL_QUEUE_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include "heap_queue.h"
+
+/**
+ * @brief The ExternalPriorityQueue class
+ * Prioritni fronta hodnot typu "int" s omezenou pameti, na vrcholu je vzdy
+ * nejvetsi hodnota. Nove hodnoty se vkladaji do haldy v pameti, po jejim
+ * zaplneni se halda serazena zapise do docasneho souboru jako tzv. beh. Behy
+ * se ctou postupne po velkych blocich a slucuji se az pri odebirani (k-cestne
+ * slouceni pres haldu prvnich hodnot behu). Presahne-li pocet behu limit,
+ * vsechny behy se slouci do jednoho.
+ * Polovinu pametoveho limitu zabira halda, druhou polovinu bloky behu.
+ */
+class ExternalPriorityQueue
+{
+public:
+    /**
+     * @brief Vychozi velikost bloku cteni a zapisu v bajtech.
+     */
+    static const size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+    /**
+     * @brief ExternalPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu.
+     * @param memoryBudget Pametovy limit fronty v bajtech.
+     * @param blockSize Velikost bloku cteni a zapisu v bajtech.
+     * @throw std::invalid_argument Pokud se do poloviny limitu nevejdou
+     * alespon 4 bloky.
+     */
+    explicit ExternalPriorityQueue(size_t memoryBudget, size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    /**
+     * @brief ~ExternalPriorityQueue
+     * Destruktor, odstrani vsechny polozky a zavre docasne soubory.
+     */
+    ~ExternalPriorityQueue();
+
+    ExternalPriorityQueue(const ExternalPriorityQueue &) = delete;
+    ExternalPriorityQueue &operator=(const ExternalPriorityQueue &) = delete;
+
+    /**
+     * @brief Insert
+     * Vlozi hodnotu "value" do fronty. Je-li halda plna, zapise se nejprve
+     * jako novy beh na disk.
+     * @param value Vkladana hodnota.
+     * @return Vrati false, pokud halda je plna a nelze ji zapsat na disk,
+     * jinak true.
+     */
+    bool Insert(int value);
+
+    /**
+     * @brief GetTop
+     * Vraci ukazatel na nejvetsi hodnotu ve fronte. Ukazatel je platny do
+     * pristi zmeny fronty.
+     * @return Vraci ukazatel na hodnotu, nebo NULL, pokud je fronta prazdna.
+     */
+    const int *GetTop() const;
+
+    /**
+     * @brief PopTop
+     * Odstrani z fronty nejvetsi hodnotu.
+     * @param value Vystupni parametr, do ktereho se ulozi odstranena hodnota.
+     * @return Vrati false, pokud je fronta prazdna nebo se nepodarilo nacist
+     * dalsi blok behu (fronta se pak nezmeni), jinak true.
+     */
+    bool PopTop(int &value);
+
+    /**
+     * @brief Length
+     * @return Vraci pocet hodnot ve fronte (v pameti i na disku).
+     */
+    size_t Length() const;
+
+    /**
+     * @brief RunCount
+     * @return Vraci pocet behu, ktere jsou zapsany na disku.
+     */
+    size_t RunCount() const;
+
+protected:
+    /**
+     * @brief Index "zadneho" behu.
+     */
+    static const size_t NONE = static_cast<size_t>(-1);
+
+    /**
+     * @brief The Run_t struct
+     * Serazeny beh. Prvni blok behu zustava v pameti a do souboru se
+     * nezapisuje, soubor tak lze cist od zacatku bez presouvani pozice.
+     */
+    struct Run_t {
+        FILE *pFile;                ///< Docasny soubor, NULL pokud je precteny.
+        size_t remaining;           ///< Pocet neprectenych hodnot v souboru.
+        std::vector<int> buffer;    ///< Nacteny blok, prazdny pro volny beh.
+        size_t pos;                 ///< Index prvni neodebrane hodnoty bloku.
+    };
+
+    /**
+     * @brief The Head_t struct
+     * Prvni neodebrana hodnota behu v halde slucovani.
+     */
+    struct Head_t {
+        int value;                  ///< Hodnota.
+        size_t run;                 ///< Index behu.
+    };
+
+    struct HeadCompare {
+        bool operator()(const Head_t &first, const Head_t &second) const
+        {
+            return first.value < second.value;
+        }
+    };
+
+    /**
+     * @brief NewRun
+     * Otevre docasny soubor pro novy beh.
+     * @return Vraci index behu, nebo NONE, pokud soubor nelze vytvorit.
+     */
+    size_t NewRun();
+
+    /**
+     * @brief Append
+     * Prida hodnotu na konec zapisovaneho behu "index", plny blok zapise.
+     * @return Vrati false, pokud se blok nepodarilo zapsat, nezapsane hodnoty
+     * pak zustanou v m_block.
+     */
+    bool Append(size_t index, int value);
+
+    /**
+     * @brief Flush
+     * Zapise m_block na konec souboru behu "run".
+     * @return Vrati false, pokud se nepodarilo zapsat cely blok, nezapsane
+     * hodnoty pak zustanou v m_block.
+     */
+    bool Flush(Run_t &run);
+
+    /**
+     * @brief Finish
+     * Dokonci zapis behu "index" a zaradi jej do slucovani. Hodnoty, ktere
+     * se nepodarilo zapsat, se vrati do haldy.
+     */
+    void Finish(size_t index);
+
+    /**
+     * @brief Spill
+     * Zapise obsah haldy na disk jako novy beh.
+     */
+    void Spill();
+
+    /**
+     * @brief Compact
+     * Slouci vsechny behy do jednoho. Pri chybe cteni nebo zapisu zustanou
+     * behy sloucene jen castecne, zadna hodnota se neztrati.
+     */
+    void Compact();
+
+    /**
+     * @brief Advance
+     * Odebere prvni hodnotu behu "index", jehoz hodnota je na vrcholu haldy
+     * slucovani, a nahradi ji dalsi hodnotou behu.
+     * @return Vrati false, pokud se nepodarilo nacist dalsi blok (beh se pak
+     * nezmeni), jinak true.
+     */
+    bool Advance(size_t index);
+
+    /**
+     * @brief Refill
+     * Nacte dalsi blok behu "run" ze souboru.
+     * @return Vrati false, pokud se blok nepodarilo nacist (beh se pak
+     * nezmeni), jinak true.
+     */
+    bool Refill(Run_t &run);
+
+    BasicPriorityQueue<int> m_heap;                     ///< Nove vlozene hodnoty.
+    BasicPriorityQueue<Head_t, HeadCompare> m_merge;    ///< Prvni hodnoty behu.
+    std::vector<Run_t> m_runs;                          ///< Behy (i volne).
+    std::vector<int> m_block;                           ///< Blok pro zapis behu.
+    size_t m_heapCapacity;                              ///< Nejvetsi pocet hodnot v halde.
+    size_t m_blockItems;                                ///< Pocet hodnot v bloku.
+    size_t m_maxRuns;                                   ///< Nejvetsi pocet behu.
+    size_t m_activeRuns;                                ///< Pocet neprectenych behu.
+    size_t m_length;                                    ///< Pocet hodnot ve fronte.
+};
+
+#endif // EXTERNAL_QUEUE_H_
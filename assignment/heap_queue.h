@@ -0,0 +1,309 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - array based d-ary heap
+//
+// $NoKeywords: $ivs_project_1 $heap_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file heap_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice a implementace prioritni fronty implementovane pomoci haldy.
+ */
+
+#pragma once
+
+#ifndef HEAP_QUEUE_H_
+#define HEAP_QUEUE_H_
+
+#include <stddef.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief The BasicPriorityQueue class
+ * Prioritni fronta polozek typu "T" implementovana pomoci d-arni haldy ulozene
+ * v souvislem poli. Polozky (vcetne pripadnych dat, ktera nesou) jsou ulozeny
+ * primo v poli, typ "T" muze byt i pouze presouvatelny (move-only).
+ * Na vrcholu haldy je vzdy "nejvetsi" polozka podle "Compare" (stejne jako
+ * std::priority_queue, Compare(a, b) vraci true, pokud ma "a" nizsi prioritu
+ * nez "b"), poradi ostatnich polozek neni definovano. Vkladani a odebirani
+ * vrcholu ma slozitost O(log n), pristup k vrcholu O(1).
+ */
+template <typename T, typename Compare = std::less<T> >
+class BasicPriorityQueue
+{
+public:
+    /**
+     * @brief Arita haldy (pocet potomku kazdeho uzlu).
+     */
+    static const size_t ARITY = 4;
+
+    /**
+     * @brief BasicPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu.
+     * @param compare Porovnani priorit polozek.
+     */
+    explicit BasicPriorityQueue(const Compare &compare = Compare())
+        : m_compare(compare)
+    {
+    }
+
+    /**
+     * @brief BasicPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu s predalokovanym mistem.
+     * @param capacity Pocet polozek, pro ktere se predem alokuje misto.
+     * @param compare Porovnani priorit polozek.
+     */
+    explicit BasicPriorityQueue(size_t capacity, const Compare &compare = Compare())
+        : m_compare(compare)
+    {
+        m_heap.reserve(capacity);
+    }
+
+    /**
+     * @brief Insert
+     * Vlozi do fronty kopii polozky "value". Slozitost O(log n).
+     * @param value Nova polozka.
+     */
+    void Insert(const T &value)
+    {
+        m_heap.push_back(value);
+        SiftUp(m_heap.size() - 1);
+    }
+
+    /**
+     * @brief Insert
+     * Presune do fronty polozku "value". Slozitost O(log n).
+     * @param value Nova polozka.
+     */
+    void Insert(T &&value)
+    {
+        m_heap.push_back(std::move(value));
+        SiftUp(m_heap.size() - 1);
+    }
+
+    /**
+     * @brief Emplace
+     * Vytvori novou polozku primo ve fronte z argumentu "args". Slozitost
+     * O(log n).
+     * @param args Argumenty konstruktoru polozky.
+     */
+    template <typename... Args>
+    void Emplace(Args &&... args)
+    {
+        m_heap.emplace_back(std::forward<Args>(args)...);
+        SiftUp(m_heap.size() - 1);
+    }
+
+    /**
+     * @brief Remove
+     * Odstrani libovolnou polozku rovnou "value" (operator ==) z fronty.
+     * Vyhledani polozky ma slozitost O(n), obnoveni haldy O(log n).
+     * @param value Hodnota polozky, ktera ma byt odstranena.
+     * @return Vrati true, pokud byla polozka nalezena a odstranena, jinak vraci false.
+     */
+    bool Remove(const T &value)
+    {
+        for (size_t i = 0; i < m_heap.size(); i++)
+        {
+            if (m_heap[i] == value)
+            {
+                RemoveAt(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Find
+     * Zjisti, zda se ve fronte nachazi polozka rovna "value" (operator ==).
+     * @param value Hodnota hledane polozky.
+     * @return Vrati true, pokud polozka existuje, jinak false.
+     */
+    bool Find(const T &value) const
+    {
+        for (size_t i = 0; i < m_heap.size(); i++)
+        {
+            if (m_heap[i] == value)
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Length
+     * Vraci delku fronty. Delka prazdne fronty je 0.
+     * @return Vrati delku fronty.
+     */
+    size_t Length() const
+    {
+        return m_heap.size();
+    }
+
+    /**
+     * @brief GetTop
+     * Vraci ukazatel na polozku s nejvyssi prioritou. Ukazatel je platny do
+     * pristi zmeny fronty.
+     * @return Vraci ukazatel na nejvetsi polozku, nebo NULL, pokud je fronta
+     * prazdna.
+     */
+    const T *GetTop() const
+    {
+        if (m_heap.empty())
+            return nullptr;
+        return &m_heap[0];
+    }
+
+    /**
+     * @brief PopTop
+     * Odstrani z fronty polozku s nejvyssi prioritou. Slozitost O(log n).
+     * @param value Vystupni parametr, do ktereho se presune odstranena polozka.
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopTop(T &value)
+    {
+        if (m_heap.empty())
+            return false;
+
+        value = std::move(m_heap[0]);
+        RemoveAt(0);
+        return true;
+    }
+
+    /**
+     * @brief PopTop
+     * Odstrani z fronty polozku s nejvyssi prioritou. Slozitost O(log n).
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopTop()
+    {
+        if (m_heap.empty())
+            return false;
+
+        RemoveAt(0);
+        return true;
+    }
+
+    /**
+     * @brief ReplaceTop
+     * Nahradi polozku s nejvyssi prioritou kopii polozky "value" (odebrani a
+     * vlozeni jednim pruchodem haldou). Fronta nesmi byt prazdna.
+     * Slozitost O(log n).
+     * @param value Nova polozka.
+     */
+    void ReplaceTop(const T &value)
+    {
+        m_heap[0] = value;
+        SiftDown(0);
+    }
+
+    /**
+     * @brief ReplaceTop
+     * Nahradi polozku s nejvyssi prioritou polozkou "value", ktera se do
+     * fronty presune. Fronta nesmi byt prazdna. Slozitost O(log n).
+     * @param value Nova polozka.
+     */
+    void ReplaceTop(T &&value)
+    {
+        m_heap[0] = std::move(value);
+        SiftDown(0);
+    }
+
+protected:
+    /**
+     * @brief SiftUp
+     * Presune polozku na indexu "index" smerem ke koreni, dokud neni
+     * obnovena vlastnost haldy.
+     * @param index Index presouvane polozky.
+     */
+    void SiftUp(size_t index)
+    {
+        // Polozka se neprohazuje, ale posouva se "dira" smerem ke koreni
+        T value = std::move(m_heap[index]);
+        while (index > 0)
+        {
+            size_t parent = (index - 1) / ARITY;
+            if (!m_compare(m_heap[parent], value))
+                break;
+            m_heap[index] = std::move(m_heap[parent]);
+            index = parent;
+        }
+        m_heap[index] = std::move(value);
+    }
+
+    /**
+     * @brief SiftDown
+     * Presune polozku na indexu "index" smerem k listum, dokud neni
+     * obnovena vlastnost haldy.
+     * @param index Index presouvane polozky.
+     */
+    void SiftDown(size_t index)
+    {
+        T value = std::move(m_heap[index]);
+        size_t size = m_heap.size();
+        for (;;)
+        {
+            size_t first = index * ARITY + 1;
+            if (first >= size)
+                break;
+
+            // Hledani potomka s nejvyssi prioritou
+            size_t last = first + ARITY < size ? first + ARITY : size;
+            size_t best = first;
+            for (size_t child = first + 1; child < last; child++)
+            {
+                if (m_compare(m_heap[best], m_heap[child]))
+                    best = child;
+            }
+
+            if (!m_compare(value, m_heap[best]))
+                break;
+            m_heap[index] = std::move(m_heap[best]);
+            index = best;
+        }
+        m_heap[index] = std::move(value);
+    }
+
+    /**
+     * @brief RemoveAt
+     * Odstrani polozku na indexu "index" a obnovi vlastnost haldy.
+     * @param index Index odstranovane polozky.
+     */
+    void RemoveAt(size_t index)
+    {
+        size_t last = m_heap.size() - 1;
+        if (index != last)
+        {
+            // Na misto odstranene polozky se presune posledni polozka haldy
+            m_heap[index] = std::move(m_heap[last]);
+            m_heap.pop_back();
+            if (index > 0 && m_compare(m_heap[(index - 1) / ARITY], m_heap[index]))
+                SiftUp(index);
+            else
+                SiftDown(index);
+        }
+        else
+            m_heap.pop_back();
+    }
+
+    std::vector<T> m_heap;      ///< Polozky haldy ulozene po urovnich.
+    Compare m_compare;          ///< Porovnani priorit polozek.
+};
+
+template <typename T, typename Compare>
+const size_t BasicPriorityQueue<T, Compare>::ARITY;
+
+/**
+ * @brief HeapPriorityQueue
+ * Prioritni fronta hodnot typu "int" implementovana pomoci haldy, na vrcholu
+ * je vzdy nejvetsi hodnota.
+ */
+typedef BasicPriorityQueue<int> HeapPriorityQueue;
+
+#endif // HEAP_QUEUE_H_
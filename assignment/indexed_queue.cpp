@@ -0,0 +1,122 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - sorted list with a hash index by value
+//
+// $NoKeywords: $ivs_project_1 $indexed_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file indexed_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty s indexem polozek podle hodnoty.
+ */
+
+#include <utility>
+
+#include "indexed_queue.h"
+
+IndexedPriorityQueue::IndexedPriorityQueue()
+    : m_pHead(nullptr), m_length(0)
+{
+}
+
+IndexedPriorityQueue::~IndexedPriorityQueue()
+{
+    // Polozky uvolni alokator po celych blocich (destruktor m_pool)
+    m_pHead = nullptr;
+}
+
+void IndexedPriorityQueue::Insert(int value)
+{
+    Element_t *element = m_pool.Allocate();
+    element->value = value;
+
+    std::unordered_map<int, Run_t>::iterator it = m_runs.find(value);
+    if (it != m_runs.end())
+    {
+        // Vkladani za prvni polozku useku se stejnou hodnotou
+        Run_t &run = it->second;
+        element->pNext = run.pFirst->pNext;
+        run.pFirst->pNext = element;
+        if (run.pLast == run.pFirst)
+        {
+            run.pLast = element;
+            Relink(element->pNext, &element->pNext);
+        }
+    }
+    else
+    {
+        // Hledani odkazu, za ktery se vlozi novy usek
+        Element_t **link = &m_pHead;
+        while (*link != nullptr && (*link)->value > value)
+            link = &(*link)->pNext;
+
+        element->pNext = *link;
+        *link = element;
+        Relink(element->pNext, &element->pNext);
+
+        Run_t run = { element, element, link };
+        m_runs.insert(std::make_pair(value, run));
+    }
+    m_length++;
+}
+
+bool IndexedPriorityQueue::Remove(int value)
+{
+    std::unordered_map<int, Run_t>::iterator it = m_runs.find(value);
+    if (it == m_runs.end())
+        return false;
+
+    Run_t &run = it->second;
+    Element_t *first = run.pFirst;
+    if (first != run.pLast)
+    {
+        // Odstraneni polozky za prvni polozkou useku, predchudce je znamy
+        Element_t *temp = first->pNext;
+        first->pNext = temp->pNext;
+        if (temp == run.pLast)
+        {
+            run.pLast = first;
+            Relink(first->pNext, &first->pNext);
+        }
+        m_pool.Release(temp);
+    }
+    else
+    {
+        // Posledni polozka useku, nasledujici usek prevezme jeho odkaz
+        *run.ppLink = first->pNext;
+        Relink(first->pNext, run.ppLink);
+        m_pool.Release(first);
+        m_runs.erase(it);
+    }
+    m_length--;
+    return true;
+}
+
+IndexedPriorityQueue::Element_t *IndexedPriorityQueue::Find(int value)
+{
+    std::unordered_map<int, Run_t>::iterator it = m_runs.find(value);
+    if (it == m_runs.end())
+        return nullptr;
+    return it->second.pFirst;
+}
+
+size_t IndexedPriorityQueue::Length()
+{
+    return m_length;
+}
+
+IndexedPriorityQueue::Element_t *IndexedPriorityQueue::GetHead()
+{
+    return m_pHead;
+}
+
+void IndexedPriorityQueue::Relink(Element_t *first, Element_t **link)
+{
+    if (first != nullptr)
+        m_runs.find(first->value)->second.ppLink = link;
+}
+
+/*** Konec souboru indexed_queue.cpp ***/
@@ -0,0 +1,124 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - sorted list with a hash index by value
+//
+// $NoKeywords: $ivs_project_1 $indexed_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file indexed_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty s indexem polozek podle hodnoty.
+ */
+
+#pragma once
+
+#ifndef INDEXED_QUEUE_H_
+#define INDEXED_QUEUE_H_
+
+#include <stddef.h>
+
+#include <unordered_map>
+
+#include "slab_pool.h"
+#include "tdd_code.h"
+
+/**
+ * @brief The IndexedPriorityQueue class
+ * Prioritni fronta (polozky vzdy serazeny od max po min) se stejnym
+ * serazenym seznamem jako PriorityQueue (GetHead() a pNext). Polozky se
+ * stejnou hodnotou tvori v seznamu souvisly usek, hashovaci tabulka uchovava
+ * pro kazdou hodnotu prvni a posledni polozku useku a odkaz, ktery na usek
+ * ukazuje (pNext predchozi polozky nebo zacatek fronty). Find a Remove tak
+ * maji ocekavanou slozitost O(1), stejne jako Insert hodnoty, ktera jiz ve
+ * fronte je. Insert nove hodnoty musi najit misto v seznamu, O(n).
+ */
+class IndexedPriorityQueue
+{
+public:
+    typedef PriorityQueue::Element_t Element_t;
+
+    /**
+     * @brief IndexedPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu.
+     */
+    IndexedPriorityQueue();
+
+    /**
+     * @brief ~IndexedPriorityQueue
+     * Destruktor, odstrani vsechny polozky i frontu samotnou.
+     */
+    ~IndexedPriorityQueue();
+
+    IndexedPriorityQueue(const IndexedPriorityQueue &) = delete;
+    IndexedPriorityQueue &operator=(const IndexedPriorityQueue &) = delete;
+
+    /**
+     * @brief Insert
+     * Zaradi novou polozku s hodnotou "value" do fronty na patricne misto (tak
+     * aby bylo zachovano poradi max->min). Pokud jiz polozka se stejnou
+     * hodnotou existuje, vlozi se za ni v case O(1).
+     * @param value Hodnota nove polozky.
+     */
+    void Insert(int value);
+
+    /**
+     * @brief Remove
+     * Odstrani polozku s hodnotou "value" z fronty a vrati "true", pokud polozka
+     * neni nalezena vrati "false". Ocekavana slozitost O(1).
+     * @param value Hodnota polozky, ktera ma byt odstranena.
+     * @return Vrati true, pokud byla polozka nalezena a odstranena, jinak vraci false.
+     */
+    bool Remove(int value);
+
+    /**
+     * @brief Find
+     * Nalezne prvni polozku s hodnotou "value". Ocekavana slozitost O(1).
+     * @param value Hodnota hledane polozky.
+     * @return Vrati ukazatel na polozku s hodnotou "value", nebo NULL pokud takova neexistuje.
+     */
+    Element_t *Find(int value);
+
+    /**
+     * @brief Length
+     * Vraci delku fronty. Delka prazdne fronty je 0.
+     * @return Vrati delku fronty.
+     */
+    size_t Length();
+
+    /**
+     * @brief GetHead
+     * Vraci ukazatel na prvni polozku ve fronte, ktera je vzdy zaroven polozkou
+     * s nejvetsi hodnotou.
+     * @return Vraci ukazatel na 1./nejvetsi polozku fronty, nebo NULL, pokud je
+     * fronta prazdna.
+     */
+    Element_t *GetHead();
+
+protected:
+    /**
+     * @brief The Run_t struct
+     * Usek polozek se stejnou hodnotou.
+     */
+    struct Run_t {
+        Element_t *pFirst;  ///< Prvni polozka useku.
+        Element_t *pLast;   ///< Posledni polozka useku.
+        Element_t **ppLink; ///< Odkaz na prvni polozku (pNext predchudce nebo m_pHead).
+    };
+
+    /**
+     * @brief Relink
+     * Po zmene predchudce useku zacinajiciho polozkou "first" ulozi novy odkaz
+     * "link" na tento usek. Pro "first" rovno NULL nedela nic.
+     */
+    void Relink(Element_t *first, Element_t **link);
+
+    Element_t *m_pHead;                         ///< Ukazatel na zacatek fronty.
+    size_t m_length;                            ///< Pocet polozek ve fronte.
+    std::unordered_map<int, Run_t> m_runs;      ///< Useky podle hodnoty.
+    SlabPool<Element_t> m_pool;                 ///< Alokator polozek fronty.
+};
+
+#endif // INDEXED_QUEUE_H_
@@ -0,0 +1,271 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - durable heap in a memory-mapped file
+//
+// $NoKeywords: $ivs_project_1 $mapped_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file mapped_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty ulozene v souboru (POSIX mmap).
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "mapped_queue.h"
+
+const uint32_t MappedPriorityQueue::MAGIC;
+const uint32_t MappedPriorityQueue::VERSION;
+
+MappedPriorityQueue::MappedPriorityQueue()
+    : m_fd(-1), m_pHeader(nullptr), m_pSlots(nullptr), m_syncEvery(0), m_changes(0)
+{
+}
+
+MappedPriorityQueue::~MappedPriorityQueue()
+{
+    Close();
+}
+
+bool MappedPriorityQueue::Open(const char *path, size_t capacity, size_t syncEvery)
+{
+    Close();
+
+    m_fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (m_fd < 0)
+        return false;
+    m_syncEvery = syncEvery;
+    m_changes = 0;
+
+    struct stat info;
+    if (fstat(m_fd, &info) != 0)
+    {
+        Close();
+        return false;
+    }
+
+    if (info.st_size == 0)
+    {
+        // Novy soubor: hlavicka a prazdna halda
+        if (capacity == 0)
+            capacity = 1;
+        if (ftruncate(m_fd, sizeof(Header_t) + capacity * sizeof(int)) != 0 || !Map(capacity))
+        {
+            Close();
+            return false;
+        }
+        m_pHeader->magic = MAGIC;
+        m_pHeader->version = VERSION;
+        m_pHeader->capacity = capacity;
+        m_pHeader->count = 0;
+        return Sync();
+    }
+
+    // Existujici soubor: kontrola hlavicky pred namapovanim
+    Header_t header;
+    if (static_cast<size_t>(info.st_size) < sizeof(Header_t) ||
+        pread(m_fd, &header, sizeof(Header_t), 0) != static_cast<ssize_t>(sizeof(Header_t)) ||
+        header.magic != MAGIC || header.version != VERSION || header.capacity == 0 ||
+        header.count > header.capacity ||
+        header.capacity > (static_cast<uint64_t>(info.st_size) - sizeof(Header_t)) / sizeof(int) ||
+        !Map(static_cast<size_t>(header.capacity)))
+    {
+        Close();
+        return false;
+    }
+
+    // Zmena prerusena pred dokoncenim mohla porusit usporadani haldy
+    int *end = m_pSlots + m_pHeader->count;
+    if (!std::is_heap(m_pSlots, end))
+        std::make_heap(m_pSlots, end);
+    return true;
+}
+
+void MappedPriorityQueue::Close()
+{
+    if (m_pHeader != nullptr)
+    {
+        Sync();
+        munmap(m_pHeader, sizeof(Header_t) + m_pHeader->capacity * sizeof(int));
+        m_pHeader = nullptr;
+        m_pSlots = nullptr;
+    }
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+        m_fd = -1;
+    }
+}
+
+bool MappedPriorityQueue::IsOpen() const
+{
+    return m_pHeader != nullptr;
+}
+
+bool MappedPriorityQueue::Insert(int value)
+{
+    if (m_pHeader == nullptr)
+        return false;
+    if (m_pHeader->count == m_pHeader->capacity && !Grow())
+        return false;
+
+    size_t index = static_cast<size_t>(m_pHeader->count);
+    m_pSlots[index] = value;
+    m_pHeader->count++;
+    SiftUp(index);
+    Changed();
+    return true;
+}
+
+bool MappedPriorityQueue::Remove(int value)
+{
+    size_t count = Length();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (m_pSlots[i] != value)
+            continue;
+
+        // Na misto odstranene hodnoty se presune posledni hodnota haldy,
+        // pocet hodnot se snizi az nakonec (posledni misto zustava platne)
+        if (i != count - 1)
+        {
+            m_pSlots[i] = m_pSlots[count - 1];
+            if (i > 0 && m_pSlots[(i - 1) / 2] < m_pSlots[i])
+                SiftUp(i);
+            else
+                SiftDown(i, count - 1);
+        }
+        m_pHeader->count--;
+        Changed();
+        return true;
+    }
+    return false;
+}
+
+bool MappedPriorityQueue::Find(int value) const
+{
+    size_t count = Length();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (m_pSlots[i] == value)
+            return true;
+    }
+    return false;
+}
+
+size_t MappedPriorityQueue::Length() const
+{
+    return m_pHeader != nullptr ? static_cast<size_t>(m_pHeader->count) : 0;
+}
+
+const int *MappedPriorityQueue::GetTop() const
+{
+    if (Length() == 0)
+        return nullptr;
+    return &m_pSlots[0];
+}
+
+bool MappedPriorityQueue::PopTop(int &value)
+{
+    if (Length() == 0)
+        return false;
+
+    // Posledni hodnota se presune na vrchol a zaradi, pocet hodnot se
+    // snizi az nakonec (posledni misto zustava platne)
+    size_t last = Length() - 1;
+    value = m_pSlots[0];
+    if (last > 0)
+    {
+        m_pSlots[0] = m_pSlots[last];
+        SiftDown(0, last);
+    }
+    m_pHeader->count--;
+    Changed();
+    return true;
+}
+
+bool MappedPriorityQueue::Sync()
+{
+    if (m_pHeader == nullptr)
+        return false;
+
+    m_changes = 0;
+    return msync(m_pHeader, sizeof(Header_t) + m_pHeader->capacity * sizeof(int), MS_SYNC) == 0;
+}
+
+bool MappedPriorityQueue::Map(size_t capacity)
+{
+    void *address = mmap(nullptr, sizeof(Header_t) + capacity * sizeof(int),
+                         PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (address == MAP_FAILED)
+        return false;
+
+    m_pHeader = static_cast<Header_t *>(address);
+    m_pSlots = reinterpret_cast<int *>(m_pHeader + 1);
+    return true;
+}
+
+bool MappedPriorityQueue::Grow()
+{
+    size_t oldCapacity = static_cast<size_t>(m_pHeader->capacity);
+    size_t capacity = oldCapacity * 2;
+    if (ftruncate(m_fd, sizeof(Header_t) + capacity * sizeof(int)) != 0)
+        return false;
+
+    // Nove mapovani vznikne drive, nez se zrusi stare, pri chybe tak fronta
+    // zustane beze zmeny. Kapacita v hlavicce se zmeni az po zvetseni souboru.
+    Header_t *oldHeader = m_pHeader;
+    if (!Map(capacity))
+        return false;
+    munmap(oldHeader, sizeof(Header_t) + oldCapacity * sizeof(int));
+    m_pHeader->capacity = capacity;
+    return true;
+}
+
+void MappedPriorityQueue::Changed()
+{
+    if (m_syncEvery != 0 && ++m_changes >= m_syncEvery)
+        Sync();
+}
+
+void MappedPriorityQueue::SiftUp(size_t index)
+{
+    int value = m_pSlots[index];
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (!(m_pSlots[parent] < value))
+            break;
+        m_pSlots[index] = m_pSlots[parent];
+        index = parent;
+    }
+    m_pSlots[index] = value;
+}
+
+void MappedPriorityQueue::SiftDown(size_t index, size_t count)
+{
+    int value = m_pSlots[index];
+    for (;;)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= count)
+            break;
+        if (child + 1 < count && m_pSlots[child] < m_pSlots[child + 1])
+            child++;
+        if (!(value < m_pSlots[child]))
+            break;
+        m_pSlots[index] = m_pSlots[child];
+        index = child;
+    }
+    m_pSlots[index] = value;
+}
+
+/*** Konec souboru mapped_queue.cpp ***/
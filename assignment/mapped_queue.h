@@ -0,0 +1,203 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - durable heap in a memory-mapped file
+//
+// $NoKeywords: $ivs_project_1 $mapped_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file mapped_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty ulozene v souboru (POSIX mmap).
+ */
+
+#pragma once
+
+#ifndef MAPPED_QUEUE_H_
+#define MAPPED_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief The MappedPriorityQueue class
+ * Prioritni fronta, jejiz obsah je ulozen v souboru namapovanem do pameti.
+ * Soubor obsahuje hlavicku a binarni haldu hodnot v souvislem poli, polozky
+ * tedy neobsahuji zadne ukazatele a po otevreni (mmap a kontrola hlavicky)
+ * je fronta ihned pouzitelna bez opetovneho vkladani polozek. Na vrcholu je
+ * vzdy nejvetsi hodnota, Insert a PopTop maji slozitost O(log n).
+ * Zmeny se do souboru zapisuji operacnim systemem prubezne, trvale ulozeni
+ * zarucuje az Sync (msync), ktery lze volat automaticky po kazdych N zmenach.
+ * Soubor je citelny pouze na architekture se stejnym poradim bajtu.
+ *
+ * Chovani pri padu programu uprostred zmeny: pocet hodnot v hlavicce se meni
+ * jako posledni (PopTop a Remove) nebo hned po zapisu nove hodnoty (Insert),
+ * hodnoty v halde se presouvaji tak, ze kazda presouvana hodnota je vzdy
+ * ulozena alespon na jednom platnem miste. Po padu tedy v souboru chybi
+ * nanejvys hodnota, ktera se prave odebirala nebo vkladala, nektera jina
+ * hodnota se v nem muze objevit dvakrat. Porusene usporadani haldy opravi
+ * Open. Hlavicka s kapacitou nebo poctem hodnot, ktere neodpovidaji velikosti
+ * souboru, se odmitne.
+ */
+class MappedPriorityQueue
+{
+public:
+    /**
+     * @brief Identifikace souboru fronty ("IVPQ").
+     */
+    static const uint32_t MAGIC = 0x51505649;
+
+    /**
+     * @brief Verze formatu souboru.
+     */
+    static const uint32_t VERSION = 1;
+
+    /**
+     * @brief MappedPriorityQueue
+     * Konstruktor, vytvori frontu, ktera neni spojena se zadnym souborem.
+     */
+    MappedPriorityQueue();
+
+    /**
+     * @brief ~MappedPriorityQueue
+     * Destruktor, ulozi a zavre soubor fronty (viz Close).
+     */
+    ~MappedPriorityQueue();
+
+    MappedPriorityQueue(const MappedPriorityQueue &) = delete;
+    MappedPriorityQueue &operator=(const MappedPriorityQueue &) = delete;
+
+    /**
+     * @brief Open
+     * Otevre soubor fronty "path", pripadne vytvori novy soubor pro "capacity"
+     * hodnot. U existujiciho souboru se zkontroluje hlavicka a usporadani
+     * haldy, halda poskozena neuplnym zapisem se v case O(n) obnovi.
+     * @param path Cesta k souboru fronty.
+     * @param capacity Pocatecni kapacita noveho souboru (pocet hodnot).
+     * @param syncEvery Pocet zmen, po kterych se automaticky vola Sync
+     * (0 = pouze pri volani Sync a Close).
+     * @return Vrati false, pokud soubor nelze otevrit nebo neni platnym
+     * souborem fronty, jinak true.
+     */
+    bool Open(const char *path, size_t capacity = 1024, size_t syncEvery = 0);
+
+    /**
+     * @brief Close
+     * Ulozi zmeny (Sync), odmapuje a zavre soubor. Fronta pote neni spojena
+     * se zadnym souborem.
+     */
+    void Close();
+
+    /**
+     * @brief IsOpen
+     * @return Vraci true, pokud je fronta spojena se souborem.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Insert
+     * Vlozi do fronty hodnotu "value". Pri zaplneni se soubor zvetsi na
+     * dvojnasobnou kapacitu (drive ziskane ukazatele prestavaji byt platne).
+     * @param value Hodnota nove polozky.
+     * @return Vrati false, pokud fronta neni otevrena nebo soubor nelze
+     * zvetsit, jinak true.
+     */
+    bool Insert(int value);
+
+    /**
+     * @brief Remove
+     * Odstrani z fronty jednu polozku s hodnotou "value". Vyhledani ma
+     * slozitost O(n), obnoveni haldy O(log n).
+     * @param value Hodnota polozky, ktera ma byt odstranena.
+     * @return Vrati true, pokud byla polozka nalezena a odstranena, jinak vraci false.
+     */
+    bool Remove(int value);
+
+    /**
+     * @brief Find
+     * Zjisti, zda se ve fronte nachazi polozka s hodnotou "value".
+     * @return Vrati true, pokud polozka existuje, jinak false.
+     */
+    bool Find(int value) const;
+
+    /**
+     * @brief Length
+     * Vraci delku fronty. Delka prazdne nebo neotevrene fronty je 0.
+     * @return Vrati delku fronty.
+     */
+    size_t Length() const;
+
+    /**
+     * @brief GetTop
+     * Vraci ukazatel na nejvetsi hodnotu ve fronte. Ukazatel je platny do
+     * pristi zmeny fronty.
+     * @return Vraci ukazatel na nejvetsi hodnotu, nebo NULL, pokud je fronta
+     * prazdna.
+     */
+    const int *GetTop() const;
+
+    /**
+     * @brief PopTop
+     * Odstrani z fronty nejvetsi hodnotu. Slozitost O(log n).
+     * @param value Vystupni parametr, do ktereho se ulozi odstranena hodnota.
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopTop(int &value);
+
+    /**
+     * @brief Sync
+     * Synchronne zapise vsechny zmeny fronty do souboru (msync).
+     * @return Vrati false, pokud zapis selhal nebo fronta neni otevrena.
+     */
+    bool Sync();
+
+protected:
+    /**
+     * @brief The Header_t struct
+     * Hlavicka souboru, za ni nasleduje "capacity" hodnot haldy.
+     */
+    struct Header_t {
+        uint32_t magic;     ///< Identifikace souboru (MAGIC).
+        uint32_t version;   ///< Verze formatu (VERSION).
+        uint64_t capacity;  ///< Pocet mist pro hodnoty.
+        uint64_t count;     ///< Pocet hodnot ve fronte.
+    };
+
+    /**
+     * @brief Map
+     * Namapuje soubor o velikosti pro "capacity" hodnot do pameti.
+     * @return Vrati false, pokud mapovani selhalo.
+     */
+    bool Map(size_t capacity);
+
+    /**
+     * @brief Grow
+     * Zdvojnasobi kapacitu souboru a znovu jej namapuje.
+     * @return Vrati false, pokud soubor nelze zvetsit.
+     */
+    bool Grow();
+
+    /**
+     * @brief Changed
+     * Zapocita jednu zmenu a podle nastaveni zavola Sync.
+     */
+    void Changed();
+
+    void SiftUp(size_t index);
+
+    /**
+     * @brief SiftDown
+     * Zaradi hodnotu na indexu "index" v halde s "count" hodnotami.
+     */
+    void SiftDown(size_t index, size_t count);
+
+    int m_fd;                   ///< Deskriptor otevreneho souboru, nebo -1.
+    Header_t *m_pHeader;        ///< Namapovana hlavicka souboru.
+    int *m_pSlots;              ///< Namapovana halda hodnot.
+    size_t m_syncEvery;         ///< Pocet zmen mezi automatickymi Sync.
+    size_t m_changes;           ///< Pocet zmen od posledniho Sync.
+};
+
+#endif // MAPPED_QUEUE_H_
@@ -0,0 +1,237 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - double-ended min-max heap
+//
+// $NoKeywords: $ivs_project_1 $min_max_heap.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file min_max_heap.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod oboustranne prioritni fronty (min-max halda).
+ */
+
+#include <utility>
+
+#include "min_max_heap.h"
+
+MinMaxHeap::MinMaxHeap()
+{
+}
+
+MinMaxHeap::MinMaxHeap(size_t capacity)
+{
+    m_heap.reserve(capacity);
+}
+
+void MinMaxHeap::Insert(int value)
+{
+    m_heap.push_back(value);
+    SiftUp(m_heap.size() - 1);
+}
+
+bool MinMaxHeap::Remove(int value)
+{
+    for (size_t i = 0; i < m_heap.size(); i++)
+    {
+        if (m_heap[i] == value)
+        {
+            RemoveAt(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MinMaxHeap::Find(int value) const
+{
+    for (size_t i = 0; i < m_heap.size(); i++)
+    {
+        if (m_heap[i] == value)
+            return true;
+    }
+    return false;
+}
+
+size_t MinMaxHeap::Length() const
+{
+    return m_heap.size();
+}
+
+const int *MinMaxHeap::PeekMin() const
+{
+    if (m_heap.empty())
+        return nullptr;
+    return &m_heap[0];
+}
+
+const int *MinMaxHeap::PeekMax() const
+{
+    if (m_heap.empty())
+        return nullptr;
+    return &m_heap[MaxIndex()];
+}
+
+bool MinMaxHeap::PopMin(int &value)
+{
+    if (m_heap.empty())
+        return false;
+
+    value = m_heap[0];
+    RemoveAt(0);
+    return true;
+}
+
+bool MinMaxHeap::PopMin()
+{
+    if (m_heap.empty())
+        return false;
+
+    RemoveAt(0);
+    return true;
+}
+
+bool MinMaxHeap::PopMax(int &value)
+{
+    if (m_heap.empty())
+        return false;
+
+    size_t index = MaxIndex();
+    value = m_heap[index];
+    RemoveAt(index);
+    return true;
+}
+
+bool MinMaxHeap::PopMax()
+{
+    if (m_heap.empty())
+        return false;
+
+    RemoveAt(MaxIndex());
+    return true;
+}
+
+bool MinMaxHeap::IsMinLevel(size_t index)
+{
+    // Uroven indexu je pocet bitu cisla (index + 1) bez jednoho
+    unsigned level = 0;
+    for (size_t i = index + 1; i > 1; i >>= 1)
+        level++;
+    return (level & 1) == 0;
+}
+
+size_t MinMaxHeap::MaxIndex() const
+{
+    // Nejvetsi polozka je v koreni, nebo v jednom z jeho potomku
+    if (m_heap.size() == 1)
+        return 0;
+    if (m_heap.size() == 2 || m_heap[1] >= m_heap[2])
+        return 1;
+    return 2;
+}
+
+void MinMaxHeap::SiftUp(size_t index)
+{
+    if (index == 0)
+        return;
+
+    size_t parent = (index - 1) / 2;
+    if (IsMinLevel(index))
+    {
+        // Polozka vetsi nez rodic (max uroven) patri na max urovne
+        if (m_heap[index] > m_heap[parent])
+        {
+            std::swap(m_heap[index], m_heap[parent]);
+            SiftUpLevel(parent, false);
+        }
+        else
+            SiftUpLevel(index, true);
+    }
+    else
+    {
+        // Polozka mensi nez rodic (min uroven) patri na min urovne
+        if (m_heap[index] < m_heap[parent])
+        {
+            std::swap(m_heap[index], m_heap[parent]);
+            SiftUpLevel(parent, true);
+        }
+        else
+            SiftUpLevel(index, false);
+    }
+}
+
+void MinMaxHeap::SiftUpLevel(size_t index, bool isMin)
+{
+    int value = m_heap[index];
+    while (index > 2)
+    {
+        size_t grandparent = ((index - 1) / 2 - 1) / 2;
+        if (isMin ? !(value < m_heap[grandparent]) : !(value > m_heap[grandparent]))
+            break;
+        m_heap[index] = m_heap[grandparent];
+        index = grandparent;
+    }
+    m_heap[index] = value;
+}
+
+void MinMaxHeap::SiftDown(size_t index)
+{
+    bool isMin = IsMinLevel(index);
+    size_t size = m_heap.size();
+    for (;;)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= size)
+            return;
+
+        // Hledani nejmensi (nejvetsi) polozky mezi potomky a vnuky
+        size_t best = child;
+        size_t last = 4 * index + 7 < size ? 4 * index + 7 : size;
+        size_t candidates[] = { child + 1, 2 * child + 1, 2 * child + 2,
+                                2 * child + 3, 2 * child + 4 };
+        for (size_t i = 0; i < 5; i++)
+        {
+            size_t candidate = candidates[i];
+            if (candidate >= last)
+                continue;
+            if (isMin ? m_heap[candidate] < m_heap[best]
+                      : m_heap[candidate] > m_heap[best])
+                best = candidate;
+        }
+
+        if (isMin ? !(m_heap[best] < m_heap[index]) : !(m_heap[best] > m_heap[index]))
+            return;
+        std::swap(m_heap[best], m_heap[index]);
+
+        // Po vymene s primym potomkem je vlastnost haldy obnovena
+        if (best <= child + 1)
+            return;
+
+        // Vnuk: polozka musi zustat na spravne strane sveho noveho rodice
+        size_t parent = (best - 1) / 2;
+        if (isMin ? m_heap[best] > m_heap[parent] : m_heap[best] < m_heap[parent])
+            std::swap(m_heap[best], m_heap[parent]);
+        index = best;
+    }
+}
+
+void MinMaxHeap::RemoveAt(size_t index)
+{
+    size_t last = m_heap.size() - 1;
+    if (index != last)
+    {
+        // Na misto odstranene polozky se presune posledni polozka haldy,
+        // ktera muze porusovat vlastnost haldy smerem nahoru i dolu. Pokud
+        // se vymeni s rodicem, poputuje dolu puvodni hodnota rodice.
+        m_heap[index] = m_heap[last];
+        m_heap.pop_back();
+        SiftUp(index);
+        SiftDown(index);
+    }
+    else
+        m_heap.pop_back();
+}
+
+/*** Konec souboru min_max_heap.cpp ***/
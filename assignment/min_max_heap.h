@@ -0,0 +1,172 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - double-ended min-max heap
+//
+// $NoKeywords: $ivs_project_1 $min_max_heap.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file min_max_heap.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani oboustranne prioritni fronty (min-max halda).
+ */
+
+#pragma once
+
+#ifndef MIN_MAX_HEAP_H_
+#define MIN_MAX_HEAP_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+/**
+ * @brief The MinMaxHeap class
+ * Oboustranna prioritni fronta implementovana pomoci tzv. min-max haldy
+ * ulozene v souvislem poli. Urovne binarni haldy se stridaji: polozky na sudych
+ * urovnich (vcetne korene) jsou mensi nebo rovny vsem svym potomkum, polozky
+ * na lichych urovnich vetsi nebo rovny. Nejmensi polozka je tedy vzdy v koreni
+ * a nejvetsi v jednom z jeho potomku, pristup k obema koncum fronty ma
+ * slozitost O(1), vkladani a odebirani O(log n).
+ */
+class MinMaxHeap
+{
+public:
+    /**
+     * @brief MinMaxHeap
+     * Konstruktor, vytvori prazdnou frontu.
+     */
+    MinMaxHeap();
+
+    /**
+     * @brief MinMaxHeap
+     * Konstruktor, vytvori prazdnou frontu s predalokovanym mistem.
+     * @param capacity Pocet polozek, pro ktere se predem alokuje misto.
+     */
+    explicit MinMaxHeap(size_t capacity);
+
+    /**
+     * @brief Insert
+     * Vlozi do fronty novou hodnotu "value". Slozitost O(log n).
+     * @param value Hodnota nove polozky.
+     */
+    void Insert(int value);
+
+    /**
+     * @brief Remove
+     * Odstrani z fronty jednu polozku s hodnotou "value". Vyhledani polozky ma
+     * slozitost O(n), obnoveni haldy O(log n).
+     * @param value Hodnota polozky, ktera ma byt odstranena.
+     * @return Vrati true, pokud byla polozka nalezena a odstranena, jinak vraci false.
+     */
+    bool Remove(int value);
+
+    /**
+     * @brief Find
+     * Zjisti, zda se ve fronte nachazi polozka s hodnotou "value".
+     * @param value Hodnota hledane polozky.
+     * @return Vrati true, pokud polozka existuje, jinak false.
+     */
+    bool Find(int value) const;
+
+    /**
+     * @brief Length
+     * Vraci delku fronty. Delka prazdne fronty je 0.
+     * @return Vrati delku fronty.
+     */
+    size_t Length() const;
+
+    /**
+     * @brief PeekMin
+     * Vraci ukazatel na nejmensi hodnotu ve fronte. Slozitost O(1). Ukazatel
+     * je platny do pristi zmeny fronty.
+     * @return Vraci ukazatel na nejmensi hodnotu, nebo NULL, pokud je fronta
+     * prazdna.
+     */
+    const int *PeekMin() const;
+
+    /**
+     * @brief PeekMax
+     * Vraci ukazatel na nejvetsi hodnotu ve fronte. Slozitost O(1). Ukazatel
+     * je platny do pristi zmeny fronty.
+     * @return Vraci ukazatel na nejvetsi hodnotu, nebo NULL, pokud je fronta
+     * prazdna.
+     */
+    const int *PeekMax() const;
+
+    /**
+     * @brief PopMin
+     * Odstrani z fronty nejmensi polozku. Slozitost O(log n).
+     * @param value Vystupni parametr, do ktereho se ulozi odstranena hodnota.
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopMin(int &value);
+
+    /**
+     * @brief PopMin
+     * Odstrani z fronty nejmensi polozku. Slozitost O(log n).
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopMin();
+
+    /**
+     * @brief PopMax
+     * Odstrani z fronty nejvetsi polozku. Slozitost O(log n).
+     * @param value Vystupni parametr, do ktereho se ulozi odstranena hodnota.
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopMax(int &value);
+
+    /**
+     * @brief PopMax
+     * Odstrani z fronty nejvetsi polozku. Slozitost O(log n).
+     * @return Vrati false, pokud je fronta prazdna, jinak true.
+     */
+    bool PopMax();
+
+protected:
+    /**
+     * @brief IsMinLevel
+     * @return Vraci true, pokud index "index" lezi na sude (min) urovni.
+     */
+    static bool IsMinLevel(size_t index);
+
+    /**
+     * @brief MaxIndex
+     * @return Vraci index nejvetsi polozky neprazdne haldy.
+     */
+    size_t MaxIndex() const;
+
+    /**
+     * @brief SiftUp
+     * Presune polozku na indexu "index" smerem ke koreni, dokud neni
+     * obnovena vlastnost haldy.
+     */
+    void SiftUp(size_t index);
+
+    /**
+     * @brief SiftUpLevel
+     * Presune polozku po prarodicich na urovnich stejneho typu. Pro "isMin"
+     * smerem nahoru putuji mensi hodnoty, jinak vetsi.
+     */
+    void SiftUpLevel(size_t index, bool isMin);
+
+    /**
+     * @brief SiftDown
+     * Presune polozku na indexu "index" smerem k listum, dokud neni obnovena
+     * vlastnost haldy.
+     */
+    void SiftDown(size_t index);
+
+    /**
+     * @brief RemoveAt
+     * Odstrani polozku na indexu "index" a obnovi vlastnost haldy.
+     */
+    void RemoveAt(size_t index);
+
+    std::vector<int> m_heap;    ///< Polozky haldy ulozene po urovnich.
+};
+
+#endif // MIN_MAX_HEAP_H_
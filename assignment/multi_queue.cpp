@@ -0,0 +1,204 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - relaxed sharded MultiQueue
+//
+// $NoKeywords: $ivs_project_1 $multi_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file multi_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod relaxovane prioritni fronty slozene z vice front.
+ */
+
+#include <limits.h>
+#include <stdint.h>
+
+#include <functional>
+#include <thread>
+
+#include "multi_queue.h"
+
+const long long MultiQueue::EMPTY = LLONG_MIN;
+
+namespace {
+
+/**
+ * @brief Random
+ * Generator nahodnych cisel (xorshift32) s vlastnim stavem pro kazde vlakno.
+ * @return Vraci pseudonahodne cislo.
+ */
+uint32_t Random()
+{
+    static thread_local uint32_t seed = 0;
+    if (seed == 0)
+        seed = static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1;
+
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+} // namespace
+
+MultiQueue::MultiQueue(size_t threads, size_t factor, bool trackRankError)
+    : m_aShards(nullptr), m_shardCount(threads * factor),
+      m_trackRankError(trackRankError), m_measured(0), m_rankSum(0), m_rankMax(0)
+{
+    if (m_shardCount == 0)
+        m_shardCount = 1;
+
+    m_aShards = new Shard_t[m_shardCount];
+    for (size_t i = 0; i < m_shardCount; i++)
+    {
+        m_aShards[i].top.store(EMPTY);
+        m_aShards[i].length.store(0);
+    }
+}
+
+MultiQueue::~MultiQueue()
+{
+    delete[] m_aShards;
+}
+
+void MultiQueue::Insert(int value)
+{
+    // Pri obsazenem zamku se zkusi jina nahodna fronta, teprve po nekolika
+    // neuspesnych pokusech se na zamek ceka
+    for (size_t attempt = 0; ; attempt++)
+    {
+        Shard_t &shard = m_aShards[Random() % m_shardCount];
+        std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+        if (attempt < m_shardCount)
+        {
+            if (!lock.try_lock())
+                continue;
+        }
+        else
+            lock.lock();
+
+        shard.queue.Insert(value);
+        shard.length++;
+        UpdateTop(shard);
+        return;
+    }
+}
+
+bool MultiQueue::PopMax(int &value)
+{
+    for (size_t attempt = 0; attempt < 2 * m_shardCount; attempt++)
+    {
+        Shard_t &first = m_aShards[Random() % m_shardCount];
+        Shard_t &second = m_aShards[Random() % m_shardCount];
+        Shard_t &shard = first.top.load() >= second.top.load() ? first : second;
+        if (shard.top.load() == EMPTY)
+            continue;
+
+        std::unique_lock<std::mutex> lock(shard.mutex, std::try_to_lock);
+        if (!lock.owns_lock())
+            continue;
+
+        PriorityQueue::Element_t *head = shard.queue.GetHead();
+        if (head == nullptr)
+            continue;
+
+        value = head->value;
+        shard.queue.Remove(value);
+        shard.length--;
+        UpdateTop(shard);
+        lock.unlock();
+
+        if (m_trackRankError)
+            MeasureRank(value);
+        return true;
+    }
+
+    // Nahodne zvolene fronty byly opakovane prazdne, odebira se z fronty s
+    // nejvetsim zacatkem ze vsech
+    for (;;)
+    {
+        Shard_t *best = nullptr;
+        for (size_t i = 0; i < m_shardCount; i++)
+        {
+            if (m_aShards[i].top.load() != EMPTY &&
+                (best == nullptr || m_aShards[i].top.load() > best->top.load()))
+                best = &m_aShards[i];
+        }
+        if (best == nullptr)
+            return false;
+
+        std::unique_lock<std::mutex> lock(best->mutex);
+        PriorityQueue::Element_t *head = best->queue.GetHead();
+        if (head == nullptr)
+            continue;
+
+        value = head->value;
+        best->queue.Remove(value);
+        best->length--;
+        UpdateTop(*best);
+        lock.unlock();
+
+        if (m_trackRankError)
+            MeasureRank(value);
+        return true;
+    }
+}
+
+size_t MultiQueue::Length() const
+{
+    size_t length = 0;
+    for (size_t i = 0; i < m_shardCount; i++)
+        length += m_aShards[i].length.load();
+    return length;
+}
+
+size_t MultiQueue::ShardCount() const
+{
+    return m_shardCount;
+}
+
+PriorityQueue::Element_t *MultiQueue::GetHead(size_t shard)
+{
+    if (shard >= m_shardCount)
+        return nullptr;
+    return m_aShards[shard].queue.GetHead();
+}
+
+MultiQueue::Stats_t MultiQueue::GetStats() const
+{
+    Stats_t stats;
+    stats.pops = m_measured.load();
+    stats.meanRankError = stats.pops != 0 ? static_cast<double>(m_rankSum.load()) / stats.pops : 0.0;
+    stats.maxRankError = m_rankMax.load();
+    return stats;
+}
+
+void MultiQueue::UpdateTop(Shard_t &shard)
+{
+    PriorityQueue::Element_t *head = shard.queue.GetHead();
+    shard.top.store(head != nullptr ? head->value : EMPTY);
+}
+
+void MultiQueue::MeasureRank(int value)
+{
+    // Fronty jsou serazene, v kazde staci projit polozky vetsi nez "value"
+    size_t rank = 0;
+    for (size_t i = 0; i < m_shardCount; i++)
+    {
+        std::lock_guard<std::mutex> lock(m_aShards[i].mutex);
+        for (PriorityQueue::Element_t *element = m_aShards[i].queue.GetHead();
+             element != nullptr && element->value > value; element = element->pNext)
+            rank++;
+    }
+
+    m_measured++;
+    m_rankSum += rank;
+    size_t max = m_rankMax.load();
+    while (rank > max && !m_rankMax.compare_exchange_weak(max, rank))
+        ;   // zamerne opakovani
+}
+
+/*** Konec souboru multi_queue.cpp ***/
@@ -0,0 +1,155 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - relaxed sharded MultiQueue
+//
+// $NoKeywords: $ivs_project_1 $multi_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file multi_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani relaxovane prioritni fronty slozene z vice front.
+ */
+
+#pragma once
+
+#ifndef MULTI_QUEUE_H_
+#define MULTI_QUEUE_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <mutex>
+
+#include "tdd_code.h"
+
+/**
+ * @brief The MultiQueue class
+ * Relaxovana prioritni fronta pro soubezny pristup vice vlaken slozena z
+ * c * P nezavislych front PriorityQueue (P je pocet vlaken, c faktor).
+ * Insert vlozi polozku do nahodne fronty, PopMax porovna zacatky dvou nahodne
+ * zvolenych front a odebere vetsi z nich. Odebrana polozka tedy nemusi byt
+ * nejvetsi v cele fronte, o kolik polozek se lisi (tzv. rank error) lze
+ * volitelne sledovat metodou GetStats.
+ */
+class MultiQueue
+{
+public:
+    /**
+     * @brief The Stats_t struct
+     * Statistika kvality odebirani. Rank error odebrane polozky je pocet
+     * polozek ve fronte, ktere byly v dobe odebrani vetsi nez ona.
+     */
+    struct Stats_t {
+        size_t pops;            ///< Pocet mereni (odebranych polozek).
+        double meanRankError;   ///< Prumerny rank error.
+        size_t maxRankError;    ///< Nejvetsi namereny rank error.
+    };
+
+    /**
+     * @brief MultiQueue
+     * Konstruktor, vytvori prazdnou frontu slozenou z threads * factor front.
+     * @param threads Predpokladany pocet soubezne pracujicich vlaken.
+     * @param factor Pocet front na jedno vlakno.
+     * @param trackRankError Pokud je true, meri se rank error kazde odebrane
+     * polozky (vyrazne zpomaluje PopMax, urceno pro ladeni).
+     */
+    explicit MultiQueue(size_t threads, size_t factor = 2, bool trackRankError = false);
+
+    /**
+     * @brief ~MultiQueue
+     * Destruktor, odstrani vsechny fronty i polozky v nich.
+     */
+    ~MultiQueue();
+
+    MultiQueue(const MultiQueue &) = delete;
+    MultiQueue &operator=(const MultiQueue &) = delete;
+
+    /**
+     * @brief Insert
+     * Vlozi novou polozku s hodnotou "value" do nahodne zvolene fronty.
+     * @param value Hodnota nove polozky.
+     */
+    void Insert(int value);
+
+    /**
+     * @brief PopMax
+     * Odebere vetsi ze zacatku dvou nahodne zvolenych front.
+     * @param value Vystupni parametr, do ktereho se ulozi hodnota odstranene
+     * polozky.
+     * @return Vrati false, pokud jsou vsechny fronty prazdne, jinak true.
+     */
+    bool PopMax(int &value);
+
+    /**
+     * @brief Length
+     * Vraci celkovy pocet polozek ve vsech frontach.
+     * @return Vrati delku fronty.
+     */
+    size_t Length() const;
+
+    /**
+     * @brief ShardCount
+     * @return Vraci pocet dilcich front.
+     */
+    size_t ShardCount() const;
+
+    /**
+     * @brief GetHead
+     * Vraci ukazatel na prvni (nejvetsi) polozku dilci fronty "shard". Fronta
+     * se smi takto prochazet jen pokud ji soucasne nemeni jine vlakno.
+     * @param shard Index dilci fronty.
+     * @return Vraci ukazatel na 1. polozku dilci fronty, nebo NULL, pokud je
+     * prazdna.
+     */
+    PriorityQueue::Element_t *GetHead(size_t shard);
+
+    /**
+     * @brief GetStats
+     * @return Vraci statistiku rank erroru (nulovou, pokud neni sledovan).
+     */
+    Stats_t GetStats() const;
+
+protected:
+    /**
+     * @brief The Shard_t struct
+     * Dilci fronta chranena vlastnim zamkem. Nejvetsi hodnota je navic
+     * ulozena v atomicke promenne, aby ji slo porovnat bez zamku.
+     */
+    struct Shard_t {
+        std::mutex mutex;               ///< Zamek dilci fronty.
+        PriorityQueue queue;            ///< Polozky dilci fronty.
+        std::atomic<long long> top;     ///< Nejvetsi hodnota nebo EMPTY.
+        std::atomic<size_t> length;     ///< Pocet polozek dilci fronty.
+        char padding[64];               ///< Oddeleni od dalsi dilci fronty.
+    };
+
+    /**
+     * @brief Hodnota "top" prazdne dilci fronty.
+     */
+    static const long long EMPTY;
+
+    /**
+     * @brief UpdateTop
+     * Aktualizuje "top" dilci fronty, volajici drzi jeji zamek.
+     */
+    static void UpdateTop(Shard_t &shard);
+
+    /**
+     * @brief MeasureRank
+     * Spocita polozky vetsi nez "value" ve vsech dilcich frontach a zapocita
+     * vysledek do statistiky.
+     */
+    void MeasureRank(int value);
+
+    Shard_t *m_aShards;                 ///< Pole dilcich front.
+    size_t m_shardCount;                ///< Pocet dilcich front.
+    bool m_trackRankError;              ///< Sleduje se rank error.
+    std::atomic<size_t> m_measured;     ///< Pocet mereni rank erroru.
+    std::atomic<size_t> m_rankSum;      ///< Soucet rank erroru.
+    std::atomic<size_t> m_rankMax;      ///< Nejvetsi rank error.
+};
+
+#endif // MULTI_QUEUE_H_
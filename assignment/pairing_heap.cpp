@@ -0,0 +1,193 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - addressable pairing heap
+//
+// $NoKeywords: $ivs_project_1 $pairing_heap.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file pairing_heap.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty s adresovatelnymi polozkami.
+ */
+
+#include "pairing_heap.h"
+
+PairingHeap::PairingHeap()
+    : m_pRoot(nullptr), m_length(0)
+{
+}
+
+PairingHeap::~PairingHeap()
+{
+    // Polozky uvolni alokator po celych blocich (destruktor m_pool)
+    m_pRoot = nullptr;
+}
+
+PairingHeap::Handle_t PairingHeap::Insert(int value)
+{
+    Node_t *node = m_pool.Allocate();
+    node->value = value;
+    node->pChild = node->pSibling = node->pPrev = nullptr;
+
+    m_pRoot = m_pRoot != nullptr ? Link(m_pRoot, node) : node;
+    m_length++;
+    return node;
+}
+
+void PairingHeap::UpdatePriority(Handle_t handle, int value)
+{
+    if (value >= handle->value)
+    {
+        // Zvyseni hodnoty: podstrom zustava haldou, staci jej pripojit ke koreni
+        handle->value = value;
+        if (handle != m_pRoot)
+        {
+            Cut(handle);
+            m_pRoot = Link(m_pRoot, handle);
+        }
+    }
+    else
+    {
+        // Snizeni hodnoty: potomci se vrati do haldy, polozka se vlozi znovu
+        Detach(handle);
+        handle->value = value;
+        m_pRoot = m_pRoot != nullptr ? Link(m_pRoot, handle) : handle;
+    }
+}
+
+void PairingHeap::Erase(Handle_t handle)
+{
+    Detach(handle);
+    m_pool.Release(handle);
+    m_length--;
+}
+
+PairingHeap::Handle_t PairingHeap::GetTop() const
+{
+    return m_pRoot;
+}
+
+bool PairingHeap::PopTop(int &value)
+{
+    if (m_pRoot == nullptr)
+        return false;
+
+    value = m_pRoot->value;
+    Erase(m_pRoot);
+    return true;
+}
+
+bool PairingHeap::PopTop()
+{
+    if (m_pRoot == nullptr)
+        return false;
+
+    Erase(m_pRoot);
+    return true;
+}
+
+void PairingHeap::Meld(PairingHeap &&other)
+{
+    if (&other == this || other.m_pRoot == nullptr)
+        return;
+
+    m_pRoot = m_pRoot != nullptr ? Link(m_pRoot, other.m_pRoot) : other.m_pRoot;
+    m_length += other.m_length;
+    m_pool.Steal(other.m_pool);
+
+    other.m_pRoot = nullptr;
+    other.m_length = 0;
+}
+
+size_t PairingHeap::Length() const
+{
+    return m_length;
+}
+
+PairingHeap::Node_t *PairingHeap::Link(Node_t *first, Node_t *second)
+{
+    if (second->value > first->value)
+    {
+        Node_t *temp = first;
+        first = second;
+        second = temp;
+    }
+
+    // "second" se stane prvnim potomkem "first"
+    second->pSibling = first->pChild;
+    if (first->pChild != nullptr)
+        first->pChild->pPrev = second;
+    second->pPrev = first;
+    first->pChild = second;
+    return first;
+}
+
+void PairingHeap::Cut(Node_t *node)
+{
+    if (node->pPrev->pChild == node)
+        node->pPrev->pChild = node->pSibling;
+    else
+        node->pPrev->pSibling = node->pSibling;
+
+    if (node->pSibling != nullptr)
+        node->pSibling->pPrev = node->pPrev;
+    node->pSibling = node->pPrev = nullptr;
+}
+
+PairingHeap::Node_t *PairingHeap::Combine(Node_t *first)
+{
+    if (first == nullptr)
+        return nullptr;
+
+    // 1. pruchod: spojovani dvojic zleva doprava, vysledky se ukladaji do
+    // zasobniku propojeneho pres pSibling (nejpravejsi je na vrcholu)
+    Node_t *stack = nullptr;
+    while (first != nullptr)
+    {
+        Node_t *tree = first;
+        Node_t *second = tree->pSibling;
+        first = second != nullptr ? second->pSibling : nullptr;
+
+        tree->pSibling = tree->pPrev = nullptr;
+        if (second != nullptr)
+        {
+            second->pSibling = second->pPrev = nullptr;
+            tree = Link(tree, second);
+        }
+        tree->pSibling = stack;
+        stack = tree;
+    }
+
+    // 2. pruchod: postupne spojovani zprava doleva
+    Node_t *result = stack;
+    stack = stack->pSibling;
+    result->pSibling = nullptr;
+    while (stack != nullptr)
+    {
+        Node_t *tree = stack;
+        stack = stack->pSibling;
+        tree->pSibling = nullptr;
+        result = Link(result, tree);
+    }
+    return result;
+}
+
+void PairingHeap::Detach(Node_t *node)
+{
+    Node_t *children = Combine(node->pChild);
+    node->pChild = nullptr;
+
+    if (node == m_pRoot)
+        m_pRoot = children;
+    else
+    {
+        Cut(node);
+        if (children != nullptr)
+            m_pRoot = Link(m_pRoot, children);
+    }
+}
+
+/*** Konec souboru pairing_heap.cpp ***/
@@ -0,0 +1,173 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - addressable pairing heap
+//
+// $NoKeywords: $ivs_project_1 $pairing_heap.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file pairing_heap.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty s adresovatelnymi polozkami.
+ */
+
+#pragma once
+
+#ifndef PAIRING_HEAP_H_
+#define PAIRING_HEAP_H_
+
+#include <stddef.h>
+
+#include "slab_pool.h"
+
+/**
+ * @brief The PairingHeap class
+ * Prioritni fronta implementovana pomoci tzv. pairing heap. Insert vraci
+ * stabilni odkaz (handle) na vlozenou polozku, pomoci ktereho lze polozce
+ * zmenit hodnotu nebo ji odstranit, aniz by se musela vyhledavat. Na vrcholu
+ * je vzdy polozka s nejvetsi hodnotou.
+ * Insert a zvyseni hodnoty maji slozitost O(1), odebrani vrcholu, snizeni
+ * hodnoty a odstraneni polozky O(log n) (amortizovane).
+ */
+class PairingHeap
+{
+public:
+    /**
+     * @brief The Node_t struct
+     * Polozka haldy. Obsah polozky se smi menit pouze metodami haldy.
+     */
+    struct Node_t {
+        int value;          ///< Hodnota polozky.
+
+        Node_t *pChild;     ///< Prvni (nejlevejsi) potomek.
+        Node_t *pSibling;   ///< Nasledujici sourozenec.
+        Node_t *pPrev;      ///< Predchozi sourozenec, u prvniho potomka rodic.
+    };
+
+    /**
+     * @brief Handle_t
+     * Odkaz na polozku haldy, platny dokud polozka neni odstranena.
+     */
+    typedef Node_t *Handle_t;
+
+    /**
+     * @brief PairingHeap
+     * Konstruktor, vytvori prazdnou haldu.
+     */
+    PairingHeap();
+
+    /**
+     * @brief ~PairingHeap
+     * Destruktor, odstrani vsechny polozky i haldu samotnou.
+     */
+    ~PairingHeap();
+
+    PairingHeap(const PairingHeap &) = delete;
+    PairingHeap &operator=(const PairingHeap &) = delete;
+
+    /**
+     * @brief Insert
+     * Vlozi novou polozku s hodnotou "value" do haldy. Slozitost O(1).
+     * @param value Hodnota nove polozky.
+     * @return Vraci odkaz na novou polozku.
+     */
+    Handle_t Insert(int value);
+
+    /**
+     * @brief UpdatePriority
+     * Zmeni hodnotu polozky "handle" na "value". Zvyseni hodnoty ma slozitost
+     * O(1), snizeni O(log n) (amortizovane).
+     * @param handle Odkaz na polozku v teto halde.
+     * @param value Nova hodnota polozky.
+     */
+    void UpdatePriority(Handle_t handle, int value);
+
+    /**
+     * @brief Erase
+     * Odstrani polozku "handle" z haldy, odkaz tim prestava byt platny.
+     * Slozitost O(log n) (amortizovane).
+     * @param handle Odkaz na polozku v teto halde.
+     */
+    void Erase(Handle_t handle);
+
+    /**
+     * @brief GetTop
+     * Vraci odkaz na polozku s nejvetsi hodnotou. Slozitost O(1).
+     * @return Vraci odkaz na nejvetsi polozku, nebo NULL, pokud je halda
+     * prazdna.
+     */
+    Handle_t GetTop() const;
+
+    /**
+     * @brief PopTop
+     * Odstrani z haldy polozku s nejvetsi hodnotou. Slozitost O(log n)
+     * (amortizovane).
+     * @param value Vystupni parametr, do ktereho se ulozi hodnota odstranene
+     * polozky.
+     * @return Vrati false, pokud je halda prazdna, jinak true.
+     */
+    bool PopTop(int &value);
+
+    /**
+     * @brief PopTop
+     * Odstrani z haldy polozku s nejvetsi hodnotou. Slozitost O(log n)
+     * (amortizovane).
+     * @return Vrati false, pokud je halda prazdna, jinak true.
+     */
+    bool PopTop();
+
+    /**
+     * @brief Meld
+     * Presune vsechny polozky haldy "other" do teto haldy, "other" zustane
+     * prazdna. Koreny obou hald se spoji v case O(1), halda prevezme bloky
+     * alokatoru haldy "other". Odkazy na polozky z "other" zustavaji platne
+     * a od teto chvile patri teto halde.
+     * @param other Halda, jejiz polozky budou presunuty.
+     */
+    void Meld(PairingHeap &&other);
+
+    /**
+     * @brief Length
+     * Vraci pocet polozek v halde. Delka prazdne haldy je 0.
+     * @return Vrati pocet polozek.
+     */
+    size_t Length() const;
+
+protected:
+    /**
+     * @brief Link
+     * Spoji dva stromy (jejich koreny nemaji sourozence) do jednoho, koren s
+     * mensi hodnotou se stane prvnim potomkem druheho korene.
+     * @return Vraci koren vysledneho stromu.
+     */
+    static Node_t *Link(Node_t *first, Node_t *second);
+
+    /**
+     * @brief Cut
+     * Vyjme podstrom s korenem "node" ze seznamu sourozencu jeho rodice.
+     */
+    static void Cut(Node_t *node);
+
+    /**
+     * @brief Combine
+     * Spoji seznam sourozencu zacinajici polozkou "first" do jednoho stromu
+     * (dvoupruchodove parovani zleva doprava a zprava doleva).
+     * @return Vraci koren vysledneho stromu, nebo NULL pro prazdny seznam.
+     */
+    static Node_t *Combine(Node_t *first);
+
+    /**
+     * @brief Detach
+     * Odpoji polozku "node" od haldy, jeji potomci se spoji a vrati zpet.
+     * Polozka po odpojeni nema zadne potomky ani sourozence.
+     */
+    void Detach(Node_t *node);
+
+    Node_t *m_pRoot;            ///< Koren haldy.
+    size_t m_length;            ///< Pocet polozek v halde.
+    SlabPool<Node_t> m_pool;    ///< Alokator polozek haldy.
+};
+
+#endif // PAIRING_HEAP_H_
@@ -0,0 +1,87 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - run-length encoded list of (value, count)
+//
+// $NoKeywords: $ivs_project_1 $run_length_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file run_length_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty s polozkami (hodnota, pocet).
+ */
+
+#include "run_length_queue.h"
+
+RunLengthPriorityQueue::RunLengthPriorityQueue()
+    : m_pHead(nullptr), m_length(0)
+{
+}
+
+RunLengthPriorityQueue::~RunLengthPriorityQueue()
+{
+    // Polozky uvolni alokator po celych blocich (destruktor m_pool)
+    m_pHead = nullptr;
+}
+
+void RunLengthPriorityQueue::Insert(int value)
+{
+    Element_t **link = &m_pHead;
+    while (*link != nullptr && (*link)->value > value)
+        link = &(*link)->pNext;
+
+    if (*link != nullptr && (*link)->value == value)
+        (*link)->count++;
+    else
+    {
+        Element_t *element = m_pool.Allocate();
+        element->value = value;
+        element->count = 1;
+        element->pNext = *link;
+        *link = element;
+    }
+    m_length++;
+}
+
+bool RunLengthPriorityQueue::Remove(int value)
+{
+    Element_t **link = &m_pHead;
+    while (*link != nullptr && (*link)->value > value)
+        link = &(*link)->pNext;
+
+    Element_t *element = *link;
+    if (element == nullptr || element->value != value)
+        return false;
+
+    if (--element->count == 0)
+    {
+        *link = element->pNext;
+        m_pool.Release(element);
+    }
+    m_length--;
+    return true;
+}
+
+RunLengthPriorityQueue::Element_t *RunLengthPriorityQueue::Find(int value)
+{
+    // Seznam je serazeny, hledani konci u prvni mensi hodnoty
+    Element_t *element = m_pHead;
+    while (element != nullptr && element->value > value)
+        element = element->pNext;
+
+    return element != nullptr && element->value == value ? element : nullptr;
+}
+
+size_t RunLengthPriorityQueue::Length()
+{
+    return m_length;
+}
+
+RunLengthPriorityQueue::Element_t *RunLengthPriorityQueue::GetHead()
+{
+    return m_pHead;
+}
+
+/*** Konec souboru run_length_queue.cpp ***/
@@ -0,0 +1,109 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - run-length encoded list of (value, count)
+//
+// $NoKeywords: $ivs_project_1 $run_length_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file run_length_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty s polozkami (hodnota, pocet).
+ */
+
+#pragma once
+
+#ifndef RUN_LENGTH_QUEUE_H_
+#define RUN_LENGTH_QUEUE_H_
+
+#include <stddef.h>
+
+#include "slab_pool.h"
+
+/**
+ * @brief The RunLengthPriorityQueue class
+ * Prioritni fronta (polozky vzdy serazeny od max po min) pro hodnoty s velkym
+ * poctem opakovani. Stejne jako PriorityQueue je tvorena serazenym seznamem,
+ * kazda polozka seznamu ale nese ruznou hodnotu a pocet jejich vyskytu.
+ * Vlozeni existujici hodnoty tedy pouze zvysi pocet, odstraneni jej snizi a
+ * pamet i doba pruchodu jsou umerne poctu ruznych hodnot, ne delce fronty.
+ */
+class RunLengthPriorityQueue
+{
+public:
+    /**
+     * @brief The Element_t struct
+     * Struktura polozky ve fronte.
+     */
+    struct Element_t {
+        Element_t *pNext;   ///< Ukazatel na nasledujici prvek ve fronte.
+
+        int value;          ///< Hodnota teto polozky ve fronte.
+        size_t count;       ///< Pocet vyskytu hodnoty (vzdy alespon 1).
+    };
+
+    /**
+     * @brief RunLengthPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu.
+     */
+    RunLengthPriorityQueue();
+
+    /**
+     * @brief ~RunLengthPriorityQueue
+     * Destruktor, odstrani vsechny polozky i frontu samotnou.
+     */
+    ~RunLengthPriorityQueue();
+
+    RunLengthPriorityQueue(const RunLengthPriorityQueue &) = delete;
+    RunLengthPriorityQueue &operator=(const RunLengthPriorityQueue &) = delete;
+
+    /**
+     * @brief Insert
+     * Vlozi do fronty jeden vyskyt hodnoty "value". Pokud hodnota ve fronte
+     * jiz je, zvysi se pouze pocet jejich vyskytu.
+     * @param value Hodnota nove polozky.
+     */
+    void Insert(int value);
+
+    /**
+     * @brief Remove
+     * Odstrani z fronty jeden vyskyt hodnoty "value". Polozka se odstrani az
+     * s poslednim vyskytem.
+     * @param value Hodnota, ktera ma byt odstranena.
+     * @return Vrati true, pokud byla hodnota nalezena a odstranena, jinak vraci false.
+     */
+    bool Remove(int value);
+
+    /**
+     * @brief Find
+     * Nalezne polozku s hodnotou "value".
+     * @param value Hodnota hledane polozky.
+     * @return Vrati ukazatel na polozku s hodnotou "value", nebo NULL pokud takova neexistuje.
+     */
+    Element_t *Find(int value);
+
+    /**
+     * @brief Length
+     * Vraci delku fronty (soucet poctu vyskytu vsech hodnot). Slozitost O(1).
+     * @return Vrati delku fronty.
+     */
+    size_t Length();
+
+    /**
+     * @brief GetHead
+     * Vraci ukazatel na prvni polozku ve fronte, ktera je vzdy zaroven polozkou
+     * s nejvetsi hodnotou.
+     * @return Vraci ukazatel na 1./nejvetsi polozku fronty, nebo NULL, pokud je
+     * fronta prazdna.
+     */
+    Element_t *GetHead();
+
+protected:
+    Element_t *m_pHead;             ///< Ukazatel na zacatek fronty.
+    size_t m_length;                ///< Pocet vyskytu vsech hodnot.
+    SlabPool<Element_t> m_pool;     ///< Alokator polozek fronty.
+};
+
+#endif // RUN_LENGTH_QUEUE_H_
@@ -0,0 +1,171 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - skip list index
+//
+// $NoKeywords: $ivs_project_1 $skip_list_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file skip_list_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty s indexem typu skip list.
+ */
+
+#include <stdlib.h>
+
+#include <new>
+
+#include "skip_list_queue.h"
+
+const unsigned SkipListPriorityQueue::MAX_LEVEL;
+
+SkipListPriorityQueue::SkipListPriorityQueue()
+    : m_pHeader(AllocNode(MAX_LEVEL)), m_level(1), m_length(0), m_seed(2463534242u)
+{
+}
+
+SkipListPriorityQueue::~SkipListPriorityQueue()
+{
+    Node_t *node = m_pHeader;
+    while (node != nullptr)
+    {
+        Node_t *temp = Next(node, 0);
+        free(node);
+        node = temp;
+    }
+}
+
+void SkipListPriorityQueue::Insert(int value)
+{
+    Node_t *update[MAX_LEVEL];
+    FindPredecessors(value, update);
+
+    unsigned level = RandomLevel();
+    if (level > m_level)
+    {
+        for (unsigned i = m_level; i < level; i++)
+            update[i] = m_pHeader;
+        m_level = level;
+    }
+
+    Node_t *node = AllocNode(level);
+    node->value = value;
+    for (unsigned i = 0; i < level; i++)
+    {
+        SetNext(node, i, Next(update[i], i));
+        SetNext(update[i], i, node);
+    }
+    m_length++;
+}
+
+bool SkipListPriorityQueue::Remove(int value)
+{
+    Node_t *update[MAX_LEVEL];
+    FindPredecessors(value, update);
+
+    // Prvni polozka s hodnotou <= value je ve vsech svych urovnich primo za
+    // nalezenymi predchudci
+    Node_t *node = Next(update[0], 0);
+    if (node == nullptr || node->value != value)
+        return false;
+
+    for (unsigned i = 0; i < node->level; i++)
+        SetNext(update[i], i, Next(node, i));
+    free(node);
+    m_length--;
+
+    while (m_level > 1 && Next(m_pHeader, m_level - 1) == nullptr)
+        m_level--;
+    return true;
+}
+
+SkipListPriorityQueue::Element_t *SkipListPriorityQueue::Find(int value)
+{
+    Node_t *node = m_pHeader;
+    for (unsigned i = m_level; i-- > 0;)
+    {
+        Node_t *next;
+        while ((next = Next(node, i)) != nullptr && next->value > value)
+            node = next;
+    }
+
+    // Prohledavani konci hned za posledni vetsi hodnotou
+    Node_t *next = Next(node, 0);
+    if (next != nullptr && next->value == value)
+        return next;
+    return nullptr;
+}
+
+size_t SkipListPriorityQueue::Length()
+{
+    return m_length;
+}
+
+SkipListPriorityQueue::Element_t *SkipListPriorityQueue::GetHead()
+{
+    return m_pHeader->pNext;
+}
+
+SkipListPriorityQueue::Node_t *SkipListPriorityQueue::AllocNode(unsigned level)
+{
+    size_t size = sizeof(Node_t) + (level > 1 ? level - 2 : 0) * sizeof(Node_t *);
+    void *memory = malloc(size);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+
+    Node_t *node = static_cast<Node_t *>(memory);
+    node->pNext = nullptr;
+    node->value = 0;
+    node->level = level;
+    for (unsigned i = 1; i < level; i++)
+        node->apForward[i - 1] = nullptr;
+    return node;
+}
+
+SkipListPriorityQueue::Node_t *SkipListPriorityQueue::Next(Node_t *node, unsigned level)
+{
+    if (level == 0)
+        return static_cast<Node_t *>(node->pNext);
+    return node->apForward[level - 1];
+}
+
+void SkipListPriorityQueue::SetNext(Node_t *node, unsigned level, Node_t *next)
+{
+    if (level == 0)
+        node->pNext = next;
+    else
+        node->apForward[level - 1] = next;
+}
+
+void SkipListPriorityQueue::FindPredecessors(int value, Node_t **update)
+{
+    Node_t *node = m_pHeader;
+    for (unsigned i = m_level; i-- > 0;)
+    {
+        Node_t *next;
+        while ((next = Next(node, i)) != nullptr && next->value > value)
+            node = next;
+        update[i] = node;
+    }
+}
+
+unsigned SkipListPriorityQueue::RandomLevel()
+{
+    // xorshift32
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+
+    unsigned level = 1;
+    unsigned bits = m_seed;
+    while (level < MAX_LEVEL && (bits & 3) == 0)
+    {
+        level++;
+        bits >>= 2;
+    }
+    return level;
+}
+
+/*** Konec souboru skip_list_queue.cpp ***/
@@ -0,0 +1,155 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - skip list index
+//
+// $NoKeywords: $ivs_project_1 $skip_list_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file skip_list_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty s indexem typu skip list.
+ */
+
+#pragma once
+
+#ifndef SKIP_LIST_QUEUE_H_
+#define SKIP_LIST_QUEUE_H_
+
+#include <stddef.h>
+
+#include "tdd_code.h"
+
+/**
+ * @brief The SkipListPriorityQueue class
+ * Prioritni fronta (polozky vzdy serazeny od max po min) implementovana pomoci
+ * tzv. skip listu. Kazda polozka je zaroven polozkou PriorityQueue::Element_t,
+ * takze fronta jde prochazet stejne jako PriorityQueue (GetHead() a pNext).
+ * Nektere polozky maji navic odkazy na vzdalenejsi polozky ve vyssich
+ * urovnich, diky kterym maji Insert, Remove a Find ocekavanou slozitost
+ * O(log n).
+ */
+class SkipListPriorityQueue
+{
+public:
+    typedef PriorityQueue::Element_t Element_t;
+
+    /**
+     * @brief Maximalni pocet urovni skip listu.
+     */
+    static const unsigned MAX_LEVEL = 16;
+
+    /**
+     * @brief SkipListPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu.
+     */
+    SkipListPriorityQueue();
+
+    /**
+     * @brief ~SkipListPriorityQueue
+     * Destruktor, odstrani vsechny polozky i frontu samotnou.
+     */
+    ~SkipListPriorityQueue();
+
+    SkipListPriorityQueue(const SkipListPriorityQueue &) = delete;
+    SkipListPriorityQueue &operator=(const SkipListPriorityQueue &) = delete;
+
+    /**
+     * @brief Insert
+     * Zaradi novou polozku s hodnotou "value" do fronty na patricne misto
+     * (pred polozky se stejnou hodnotou). Ocekavana slozitost O(log n).
+     * @param value Hodnota nove polozky.
+     */
+    void Insert(int value);
+
+    /**
+     * @brief Remove
+     * Odstrani polozku s hodnotou "value" z fronty. Ocekavana slozitost
+     * O(log n).
+     * @param value Hodnota polozky, ktera ma byt odstranena.
+     * @return Vrati true, pokud byla polozka nalezena a odstranena, jinak vraci false.
+     */
+    bool Remove(int value);
+
+    /**
+     * @brief Find
+     * Nalezne prvni polozku s hodnotou "value". Ocekavana slozitost O(log n).
+     * @param value Hodnota hledane polozky.
+     * @return Vrati ukazatel na polozku s hodnotou "value", nebo NULL pokud takova neexistuje.
+     */
+    Element_t *Find(int value);
+
+    /**
+     * @brief Length
+     * Vraci delku fronty. Delka prazdne fronty je 0.
+     * @return Vrati delku fronty.
+     */
+    size_t Length();
+
+    /**
+     * @brief GetHead
+     * Vraci ukazatel na prvni polozku ve fronte, ktera je vzdy zaroven polozkou
+     * s nejvetsi hodnotou.
+     * @return Vraci ukazatel na 1./nejvetsi polozku fronty, nebo NULL, pokud je
+     * fronta prazdna.
+     */
+    Element_t *GetHead();
+
+protected:
+    /**
+     * @brief The Node_t struct
+     * Polozka skip listu. Odkaz na nasledujici polozku v nejnizsi urovni je
+     * zdedeny ukazatel pNext, odkazy ve vyssich urovnich jsou ulozeny v poli
+     * apForward, ktere se alokuje v potrebne delce spolu s polozkou.
+     */
+    struct Node_t : public Element_t {
+        unsigned level;         ///< Pocet urovni, ve kterych je polozka.
+
+        Node_t *apForward[1];   ///< Odkazy v urovnich 1 az level - 1.
+    };
+
+    /**
+     * @brief AllocNode
+     * Alokuje polozku s "level" urovnemi a vynuluje jeji odkazy.
+     * @param level Pocet urovni polozky.
+     * @return Ukazatel na novou polozku.
+     */
+    static Node_t *AllocNode(unsigned level);
+
+    /**
+     * @brief Next
+     * Vraci odkaz na nasledujici polozku v urovni "level".
+     */
+    static Node_t *Next(Node_t *node, unsigned level);
+
+    /**
+     * @brief SetNext
+     * Nastavi odkaz na nasledujici polozku v urovni "level".
+     */
+    static void SetNext(Node_t *node, unsigned level, Node_t *next);
+
+    /**
+     * @brief FindPredecessors
+     * Pro kazdou uroven nalezne posledni polozku s hodnotou vetsi nez "value".
+     * @param value Hledana hodnota.
+     * @param update Vystupni pole delky MAX_LEVEL s nalezenymi polozkami.
+     */
+    void FindPredecessors(int value, Node_t **update);
+
+    /**
+     * @brief RandomLevel
+     * Nahodne zvoli pocet urovni nove polozky (kazda dalsi uroven s
+     * pravdepodobnosti 1/4).
+     * @return Pocet urovni nove polozky.
+     */
+    unsigned RandomLevel();
+
+    Node_t *m_pHeader;      ///< Hlavicka (bez hodnoty) se vsemi urovnemi.
+    unsigned m_level;       ///< Pocet aktualne pouzivanych urovni.
+    size_t m_length;        ///< Pocet polozek ve fronte.
+    unsigned m_seed;        ///< Stav generatoru nahodnych cisel.
+};
+
+#endif // SKIP_LIST_QUEUE_H_
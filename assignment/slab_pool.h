@@ -0,0 +1,254 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Slab allocator for priority queue elements
+//
+// $NoKeywords: $ivs_project_1 $slab_pool.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file slab_pool.h
+ * @author Hung Do
+ *
+ * @brief Definice a implementace alokatoru polozek pevne velikosti.
+ */
+
+#pragma once
+
+#ifndef SLAB_POOL_H_
+#define SLAB_POOL_H_
+
+#include <stddef.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief The SlabPool class
+ * Alokator polozek typu "T". Polozky jsou vykrajovany z velkych souvislych
+ * bloku, uvolnene polozky se ukladaji do tzv. free listu (odkaz na dalsi
+ * volnou polozku je ulozen primo v uvolnene polozce) a jsou znovu pouzity
+ * pri dalsi alokaci. Bloky se uvolnuji najednou az pri zaniku alokatoru,
+ * proto musi byt typ "T" trivialne destruovatelny. Alokator muze prevzit
+ * bloky jineho alokatoru (Steal), polozky se pritom nepresouvaji.
+ */
+template <typename T>
+class SlabPool
+{
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "SlabPool uvolnuje bloky bez volani destruktoru polozek");
+
+public:
+    /**
+     * @brief Velikost prvniho bloku (pocet polozek).
+     */
+    static const size_t MIN_BLOCK = 64;
+
+    /**
+     * @brief Maximalni velikost bloku (pocet polozek), do ktere se velikost
+     * bloku postupne zdvojnasobuje.
+     */
+    static const size_t MAX_BLOCK = 64 * 1024;
+
+    /**
+     * @brief SlabPool
+     * Konstruktor, vytvori prazdny alokator. Zadny blok neni alokovan.
+     */
+    SlabPool()
+        : m_pFree(nullptr), m_pFreeTail(nullptr), m_pCursor(nullptr),
+          m_pEnd(nullptr), m_nextBlock(MIN_BLOCK)
+    {
+    }
+
+    /**
+     * @brief ~SlabPool
+     * Destruktor, uvolni vsechny bloky (a tim i vsechny polozky) najednou.
+     */
+    ~SlabPool()
+    {
+        Clear();
+    }
+
+    SlabPool(const SlabPool &) = delete;
+    SlabPool &operator=(const SlabPool &) = delete;
+
+    /**
+     * @brief Allocate
+     * Vrati novou polozku inicializovanou vychozim konstruktorem. Prednostne
+     * se pouzije polozka z free listu, jinak se vykroji z aktualniho bloku,
+     * pripadne ze zbytku drive pouzitych bloku.
+     * @return Ukazatel na novou polozku.
+     */
+    T *Allocate()
+    {
+        Slot_t *slot;
+        if (m_pFree != nullptr)
+        {
+            slot = m_pFree;
+            m_pFree = slot->pNextFree;
+            if (m_pFree == nullptr)
+                m_pFreeTail = nullptr;
+        }
+        else
+        {
+            if (m_pCursor == m_pEnd)
+            {
+                if (!m_spare.empty())
+                {
+                    m_pCursor = m_spare.back().first;
+                    m_pEnd = m_spare.back().second;
+                    m_spare.pop_back();
+                }
+                else
+                    AddBlock(m_nextBlock);
+            }
+            slot = m_pCursor++;
+        }
+        return new (slot->storage) T();
+    }
+
+    /**
+     * @brief Release
+     * Vrati polozku "item" alokatoru, polozka bude znovu pouzita pri dalsi
+     * alokaci.
+     * @param item Polozka ziskana metodou Allocate tohoto alokatoru.
+     */
+    void Release(T *item)
+    {
+        Slot_t *slot = reinterpret_cast<Slot_t *>(item);
+        slot->pNextFree = m_pFree;
+        if (m_pFree == nullptr)
+            m_pFreeTail = slot;
+        m_pFree = slot;
+    }
+
+    /**
+     * @brief Reserve
+     * Zajisti, ze nasledujicich "count" alokaci (nepocitaje polozky ve free
+     * listu) bude vykrojeno z jednoho souvisleho bloku.
+     * @param count Pocet polozek.
+     */
+    void Reserve(size_t count)
+    {
+        if (static_cast<size_t>(m_pEnd - m_pCursor) < count)
+            AddBlock(count);
+    }
+
+    /**
+     * @brief Clear
+     * Uvolni vsechny bloky najednou. Vsechny drive alokovane polozky se tim
+     * stavaji neplatnymi.
+     */
+    void Clear()
+    {
+        for (size_t i = 0; i < m_blocks.size(); i++)
+            delete[] m_blocks[i];
+        m_blocks.clear();
+        m_spare.clear();
+        m_pFree = m_pFreeTail = m_pCursor = m_pEnd = nullptr;
+        m_nextBlock = MIN_BLOCK;
+    }
+
+    /**
+     * @brief Swap
+     * Prohodi obsah dvou alokatoru (vcetne vsech alokovanych polozek).
+     * @param other Druhy alokator.
+     */
+    void Swap(SlabPool &other)
+    {
+        m_blocks.swap(other.m_blocks);
+        m_spare.swap(other.m_spare);
+        std::swap(m_pFree, other.m_pFree);
+        std::swap(m_pFreeTail, other.m_pFreeTail);
+        std::swap(m_pCursor, other.m_pCursor);
+        std::swap(m_pEnd, other.m_pEnd);
+        std::swap(m_nextBlock, other.m_nextBlock);
+    }
+
+    /**
+     * @brief Steal
+     * Prevezme vsechny bloky alokatoru "other" vcetne jeho volnych polozek.
+     * Polozky alokovane z "other" zustavaji platne a od teto chvile patri
+     * tomuto alokatoru, "other" zustane prazdny. Slozitost je umerna poctu
+     * bloku, ne poctu polozek.
+     * @param other Alokator, jehoz bloky budou prevzaty.
+     */
+    void Steal(SlabPool &other)
+    {
+        if (&other == this)
+            return;
+
+        m_blocks.insert(m_blocks.end(), other.m_blocks.begin(), other.m_blocks.end());
+        other.m_blocks.clear();
+
+        // Free list druheho alokatoru se pripoji pred vlastni free list
+        if (other.m_pFree != nullptr)
+        {
+            other.m_pFreeTail->pNextFree = m_pFree;
+            if (m_pFree == nullptr)
+                m_pFreeTail = other.m_pFreeTail;
+            m_pFree = other.m_pFree;
+        }
+
+        // Nevykrojene zbytky bloku druheho alokatoru se pouziji pozdeji
+        m_spare.insert(m_spare.end(), other.m_spare.begin(), other.m_spare.end());
+        if (other.m_pCursor != other.m_pEnd)
+            m_spare.push_back(std::make_pair(other.m_pCursor, other.m_pEnd));
+        other.m_spare.clear();
+
+        other.m_pFree = other.m_pFreeTail = other.m_pCursor = other.m_pEnd = nullptr;
+        other.m_nextBlock = MIN_BLOCK;
+    }
+
+protected:
+    /**
+     * @brief The Slot_t union
+     * Misto pro jednu polozku. Dokud je polozka volna, je v ni ulozen odkaz
+     * na dalsi volnou polozku.
+     */
+    union Slot_t {
+        Slot_t *pNextFree;  ///< Ukazatel na dalsi volnou polozku.
+
+        alignas(T) unsigned char storage[sizeof(T)];  ///< Misto pro polozku.
+    };
+
+    /**
+     * @brief AddBlock
+     * Alokuje novy blok o "count" polozkach a zacne z nej vykrajovat. Zbytek
+     * predchoziho bloku se pouzije pozdeji.
+     * @param count Pocet polozek noveho bloku.
+     */
+    void AddBlock(size_t count)
+    {
+        m_blocks.reserve(m_blocks.size() + 1);
+        if (m_pCursor != m_pEnd)
+            m_spare.reserve(m_spare.size() + 1);
+        Slot_t *block = new Slot_t[count];
+        m_blocks.push_back(block);
+
+        if (m_pCursor != m_pEnd)
+            m_spare.push_back(std::make_pair(m_pCursor, m_pEnd));
+        m_pCursor = block;
+        m_pEnd = block + count;
+
+        if (m_nextBlock < MAX_BLOCK)
+            m_nextBlock *= 2;
+    }
+
+    std::vector<Slot_t *> m_blocks; ///< Vsechny alokovane bloky.
+    std::vector<std::pair<Slot_t *, Slot_t *> > m_spare; ///< Nevykrojene zbytky bloku.
+    Slot_t *m_pFree;                ///< Zacatek seznamu volnych polozek.
+    Slot_t *m_pFreeTail;            ///< Konec seznamu volnych polozek.
+    Slot_t *m_pCursor;              ///< Dalsi nevykrojena polozka bloku.
+    Slot_t *m_pEnd;                 ///< Konec aktualniho bloku.
+    size_t m_nextBlock;             ///< Velikost pristiho bloku.
+};
+
+template <typename T>
+const size_t SlabPool<T>::MIN_BLOCK;
+
+template <typename T>
+const size_t SlabPool<T>::MAX_BLOCK;
+
+#endif // SLAB_POOL_H_
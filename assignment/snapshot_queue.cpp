@@ -0,0 +1,278 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - persistent treap with immutable snapshots
+//
+// $NoKeywords: $ivs_project_1 $snapshot_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file snapshot_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty s nemennymi snimky pro ctenare.
+ */
+
+#include <stdexcept>
+
+#include "snapshot_queue.h"
+
+const unsigned SnapshotPriorityQueue::MAX_THREADS;
+
+namespace {
+
+/**
+ * Obsazene indexy vlaken (spolecne pro vsechny fronty se snimky).
+ */
+std::atomic<bool> g_aSlotUsed[SnapshotPriorityQueue::MAX_THREADS];
+
+/**
+ * @brief The ThreadSlot_t struct
+ * Index slotu hazard pointeru, ktery vlakno ziska pri prvnim snimku a uvolni
+ * pri svem ukonceni.
+ */
+struct ThreadSlot_t {
+    unsigned index;
+
+    ThreadSlot_t()
+    {
+        for (index = 0; index < SnapshotPriorityQueue::MAX_THREADS; index++)
+        {
+            if (!g_aSlotUsed[index].exchange(true))
+                return;
+        }
+        throw std::runtime_error("Prilis mnoho soubeznych vlaken.");
+    }
+
+    ~ThreadSlot_t()
+    {
+        g_aSlotUsed[index].store(false);
+    }
+};
+
+unsigned ThreadIndex()
+{
+    static thread_local ThreadSlot_t slot;
+    return slot.index;
+}
+
+} // namespace
+
+SnapshotPriorityQueue::Snapshot::Iterator::Iterator(const Node_t *root)
+{
+    PushLeft(root);
+}
+
+bool SnapshotPriorityQueue::Snapshot::Iterator::Valid() const
+{
+    return !m_stack.empty();
+}
+
+int SnapshotPriorityQueue::Snapshot::Iterator::Value() const
+{
+    return m_stack.back()->value;
+}
+
+void SnapshotPriorityQueue::Snapshot::Iterator::Next()
+{
+    const Node_t *node = m_stack.back();
+    m_stack.pop_back();
+    PushLeft(node->pRight.get());
+}
+
+void SnapshotPriorityQueue::Snapshot::Iterator::PushLeft(const Node_t *node)
+{
+    for (; node != nullptr; node = node->pLeft.get())
+        m_stack.push_back(node);
+}
+
+SnapshotPriorityQueue::Snapshot::Snapshot()
+{
+}
+
+SnapshotPriorityQueue::Snapshot::Snapshot(const NodePtr_t &root)
+    : m_root(root)
+{
+}
+
+SnapshotPriorityQueue::Snapshot::Iterator SnapshotPriorityQueue::Snapshot::Begin() const
+{
+    return Iterator(m_root.get());
+}
+
+bool SnapshotPriorityQueue::Snapshot::Find(int value) const
+{
+    return Contains(m_root.get(), value);
+}
+
+size_t SnapshotPriorityQueue::Snapshot::Length() const
+{
+    return m_root != nullptr ? m_root->size : 0;
+}
+
+SnapshotPriorityQueue::SnapshotPriorityQueue()
+    : m_pRoot(new Root_t()), m_seed(2463534242u)
+{
+    for (unsigned i = 0; i < MAX_THREADS; i++)
+        m_aHazards[i].store(nullptr);
+}
+
+SnapshotPriorityQueue::~SnapshotPriorityQueue()
+{
+    // Zadny ctenar uz drzaky nechrani
+    delete m_pRoot.load();
+    for (size_t i = 0; i < m_retired.size(); i++)
+        delete m_retired[i];
+}
+
+void SnapshotPriorityQueue::Insert(int value)
+{
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+
+    // Generator xorshift32
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+
+    NodePtr_t greater, rest;
+    Split(m_pRoot.load()->node, value, greater, rest);
+    NodePtr_t node = MakeNode(value, m_seed, nullptr, nullptr);
+    Publish(Merge(Merge(greater, node), rest));
+}
+
+bool SnapshotPriorityQueue::Remove(int value)
+{
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+
+    // Drzak aktualniho korene meni a uvolnuji jen zapisovatele pod zamkem
+    NodePtr_t root = m_pRoot.load()->node;
+    if (!Contains(root.get(), value))
+        return false;
+
+    // Hodnota je nejvetsi hodnotou stromu "rest"
+    NodePtr_t greater, rest;
+    Split(root, value, greater, rest);
+    Publish(Merge(greater, RemoveFirst(rest)));
+    return true;
+}
+
+bool SnapshotPriorityQueue::Find(int value) const
+{
+    return GetSnapshot().Find(value);
+}
+
+size_t SnapshotPriorityQueue::Length() const
+{
+    return GetSnapshot().Length();
+}
+
+SnapshotPriorityQueue::Snapshot SnapshotPriorityQueue::GetSnapshot() const
+{
+    std::atomic<Root_t *> &hazard = m_aHazards[ThreadIndex()];
+
+    // Ochrana drzaku, overeni, ze je stale zverejneny (jinak ho mohl
+    // zapisovatel mezi nactenim a ochranou uvolnit)
+    Root_t *root = m_pRoot.load();
+    for (;;)
+    {
+        hazard.store(root);
+        Root_t *current = m_pRoot.load();
+        if (current == root)
+            break;
+        root = current;
+    }
+
+    Snapshot snapshot(root->node);
+    hazard.store(nullptr);
+    return snapshot;
+}
+
+void SnapshotPriorityQueue::Publish(const NodePtr_t &node)
+{
+    Root_t *root = new Root_t();
+    root->node = node;
+    m_retired.push_back(m_pRoot.exchange(root));
+
+    // Uvolneni drzaku, ktere nechrani zadny ctenar (chranenych je nejvyse
+    // tolik, kolik je vlaken, seznam tedy zustava kratky)
+    size_t kept = 0;
+    for (size_t i = 0; i < m_retired.size(); i++)
+    {
+        bool hazard = false;
+        for (unsigned j = 0; j < MAX_THREADS && !hazard; j++)
+            hazard = m_aHazards[j].load() == m_retired[i];
+
+        if (hazard)
+            m_retired[kept++] = m_retired[i];
+        else
+            delete m_retired[i];
+    }
+    m_retired.resize(kept);
+}
+
+SnapshotPriorityQueue::NodePtr_t SnapshotPriorityQueue::MakeNode(int value, uint32_t priority,
+                                                                 const NodePtr_t &left,
+                                                                 const NodePtr_t &right)
+{
+    std::shared_ptr<Node_t> node = std::make_shared<Node_t>();
+    node->value = value;
+    node->priority = priority;
+    node->size = 1 + (left != nullptr ? left->size : 0) + (right != nullptr ? right->size : 0);
+    node->pLeft = left;
+    node->pRight = right;
+    return node;
+}
+
+bool SnapshotPriorityQueue::Contains(const Node_t *node, int value)
+{
+    while (node != nullptr && node->value != value)
+        node = value > node->value ? node->pLeft.get() : node->pRight.get();
+    return node != nullptr;
+}
+
+void SnapshotPriorityQueue::Split(const NodePtr_t &node, int value,
+                                  NodePtr_t &greater, NodePtr_t &rest)
+{
+    if (node == nullptr)
+    {
+        greater = rest = nullptr;
+        return;
+    }
+
+    // Kopiruji se pouze uzly na ceste, podstromy mimo ni se sdileji
+    NodePtr_t first, second;
+    if (node->value > value)
+    {
+        Split(node->pRight, value, first, second);
+        greater = MakeNode(node->value, node->priority, node->pLeft, first);
+        rest = second;
+    }
+    else
+    {
+        Split(node->pLeft, value, first, second);
+        greater = first;
+        rest = MakeNode(node->value, node->priority, second, node->pRight);
+    }
+}
+
+SnapshotPriorityQueue::NodePtr_t SnapshotPriorityQueue::Merge(const NodePtr_t &first,
+                                                              const NodePtr_t &second)
+{
+    if (first == nullptr)
+        return second;
+    if (second == nullptr)
+        return first;
+
+    if (first->priority > second->priority)
+        return MakeNode(first->value, first->priority, first->pLeft, Merge(first->pRight, second));
+    return MakeNode(second->value, second->priority, Merge(first, second->pLeft), second->pRight);
+}
+
+SnapshotPriorityQueue::NodePtr_t SnapshotPriorityQueue::RemoveFirst(const NodePtr_t &node)
+{
+    if (node->pLeft == nullptr)
+        return node->pRight;
+    return MakeNode(node->value, node->priority, RemoveFirst(node->pLeft), node->pRight);
+}
+
+/*** Konec souboru snapshot_queue.cpp ***/
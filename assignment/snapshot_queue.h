@@ -0,0 +1,272 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - persistent treap with immutable snapshots
+//
+// $NoKeywords: $ivs_project_1 $snapshot_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file snapshot_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty s nemennymi snimky pro ctenare.
+ */
+
+#pragma once
+
+#ifndef SNAPSHOT_QUEUE_H_
+#define SNAPSHOT_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief The SnapshotPriorityQueue class
+ * Prioritni fronta, jejiz obsah mohou vlakna ctenaru prochazet bez zamku,
+ * zatimco jina vlakna do fronty zapisuji. Fronta je perzistentni treap
+ * (vyhledavaci strom s nahodnymi prioritami uzlu), jehoz uzly se po vytvoreni
+ * uz nemeni: Insert a Remove zkopiruji jen O(log n) uzlu na ceste ke zmene a
+ * novy koren atomicky zverejni. Snimek (GetSnapshot) je pouze odkaz na koren,
+ * ziska se v case O(1) a zustava nemenny i po dalsich zmenach fronty. Uzly se
+ * uvolni, jakmile na ne neodkazuje fronta ani zadny snimek.
+ *
+ * Koren se zverejnuje jako ukazatel na drzak (Root_t) v std::atomic, nikoli
+ * pres std::atomic_load/store na shared_ptr (ty v libstdc++ berou zamek ze
+ * spolecne sady zamku). Ctenar drzak pred zkopirovanim odkazu na koren chrani
+ * tzv. hazard pointerem ve svem slotu; pokud mezitim zapisovatel zverejni novy
+ * koren, ctenar to zopakuje. Zapisujici vlakna se navzajem serializuji zamkem
+ * a stare drzaky uvolnuji, jakmile je nechrani zadny ctenar, na ctenare tedy
+ * nikdy necekaji.
+ */
+class SnapshotPriorityQueue
+{
+protected:
+    struct Node_t;
+    typedef std::shared_ptr<const Node_t> NodePtr_t;
+
+public:
+    /**
+     * @brief Maximalni pocet soucasne existujicich vlaken, ktera ziskavaji
+     * snimky front tohoto typu.
+     */
+    static const unsigned MAX_THREADS = 128;
+
+    /**
+     * @brief The Snapshot class
+     * Nemenny obraz obsahu fronty v okamziku jeho vytvoreni. Snimek lze
+     * bezpecne pouzivat i po zaniku fronty.
+     */
+    class Snapshot
+    {
+    public:
+        /**
+         * @brief The Iterator class
+         * Pruchod hodnotami snimku od max po min. Iterator je platny, dokud
+         * existuje snimek, ze ktereho vznikl.
+         */
+        class Iterator
+        {
+        public:
+            /**
+             * @brief Valid
+             * @return Vraci true, pokud iterator ukazuje na hodnotu, false na
+             * konci snimku.
+             */
+            bool Valid() const;
+
+            /**
+             * @brief Value
+             * @return Vraci aktualni hodnotu (iterator musi byt platny).
+             */
+            int Value() const;
+
+            /**
+             * @brief Next
+             * Posune iterator na nasledujici (mensi nebo rovnou) hodnotu.
+             */
+            void Next();
+
+        protected:
+            friend class Snapshot;
+
+            explicit Iterator(const Node_t *root);
+
+            /**
+             * @brief PushLeft
+             * Ulozi do zasobniku uzel "node" a vsechny jeho leve potomky.
+             */
+            void PushLeft(const Node_t *node);
+
+            std::vector<const Node_t *> m_stack;   ///< Cesta k aktualnimu uzlu.
+        };
+
+        /**
+         * @brief Snapshot
+         * Konstruktor, vytvori prazdny snimek.
+         */
+        Snapshot();
+
+        /**
+         * @brief Begin
+         * @return Vraci iterator na nejvetsi hodnotu snimku.
+         */
+        Iterator Begin() const;
+
+        /**
+         * @brief Find
+         * Zjisti, zda snimek obsahuje hodnotu "value". Slozitost O(log n).
+         * @return Vrati true, pokud hodnota existuje, jinak false.
+         */
+        bool Find(int value) const;
+
+        /**
+         * @brief Length
+         * @return Vraci pocet hodnot ve snimku.
+         */
+        size_t Length() const;
+
+    protected:
+        friend class SnapshotPriorityQueue;
+
+        explicit Snapshot(const NodePtr_t &root);
+
+        NodePtr_t m_root;   ///< Koren stromu snimku.
+    };
+
+    /**
+     * @brief SnapshotPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu.
+     */
+    SnapshotPriorityQueue();
+
+    /**
+     * @brief ~SnapshotPriorityQueue
+     * Destruktor, odstrani frontu. Uzly, na ktere odkazuji existujici snimky,
+     * se uvolni az se zanikem techto snimku.
+     */
+    ~SnapshotPriorityQueue();
+
+    SnapshotPriorityQueue(const SnapshotPriorityQueue &) = delete;
+    SnapshotPriorityQueue &operator=(const SnapshotPriorityQueue &) = delete;
+
+    /**
+     * @brief Insert
+     * Vlozi do fronty novou hodnotu "value". Ocekavana slozitost O(log n).
+     * @param value Hodnota nove polozky.
+     */
+    void Insert(int value);
+
+    /**
+     * @brief Remove
+     * Odstrani z fronty jednu polozku s hodnotou "value". Ocekavana slozitost
+     * O(log n).
+     * @param value Hodnota polozky, ktera ma byt odstranena.
+     * @return Vrati true, pokud byla polozka nalezena a odstranena, jinak vraci false.
+     */
+    bool Remove(int value);
+
+    /**
+     * @brief Find
+     * Zjisti, zda se ve fronte nachazi polozka s hodnotou "value".
+     * @return Vrati true, pokud polozka existuje, jinak false.
+     */
+    bool Find(int value) const;
+
+    /**
+     * @brief Length
+     * Vraci delku fronty. Delka prazdne fronty je 0.
+     * @return Vrati delku fronty.
+     */
+    size_t Length() const;
+
+    /**
+     * @brief GetSnapshot
+     * Vytvori nemenny snimek aktualniho obsahu fronty. Slozitost O(1), lze
+     * volat soubezne se zapisy a nebere zadny zamek.
+     * @return Vraci snimek fronty.
+     * @throw std::runtime_error Pokud snimky ziskava vice nez MAX_THREADS
+     * soucasne existujicich vlaken.
+     */
+    Snapshot GetSnapshot() const;
+
+protected:
+    /**
+     * @brief The Node_t struct
+     * Uzel stromu. Vetsi hodnoty lezi v levem podstromu, mensi v pravem
+     * (stejne hodnoty mohou byt v obou), uzel ma vetsi prioritu nez jeho
+     * potomci. Po zverejneni se uzel jiz nemeni.
+     */
+    struct Node_t {
+        int value;          ///< Hodnota uzlu.
+        uint32_t priority;  ///< Nahodna priorita uzlu.
+        size_t size;        ///< Pocet uzlu podstromu.
+
+        NodePtr_t pLeft;    ///< Podstrom s vetsimi nebo stejnymi hodnotami.
+        NodePtr_t pRight;   ///< Podstrom s mensimi nebo stejnymi hodnotami.
+    };
+
+    /**
+     * @brief The Root_t struct
+     * Drzak zverejneneho korene. Po zverejneni se nemeni, zapisovatel ho
+     * nahradi novym a stary uvolni, az ho nechrani zadny ctenar.
+     */
+    struct Root_t {
+        NodePtr_t node;     ///< Koren stromu.
+    };
+
+    /**
+     * @brief Publish
+     * Zverejni novy koren "node" a uvolni nechranene stare drzaky. Vola se
+     * pod zamkem m_writeMutex.
+     */
+    void Publish(const NodePtr_t &node);
+
+    /**
+     * @brief MakeNode
+     * Vytvori novy uzel s danymi potomky.
+     */
+    static NodePtr_t MakeNode(int value, uint32_t priority,
+                              const NodePtr_t &left, const NodePtr_t &right);
+
+    /**
+     * @brief Contains
+     * @return Vraci true, pokud strom "node" obsahuje hodnotu "value".
+     */
+    static bool Contains(const Node_t *node, int value);
+
+    /**
+     * @brief Split
+     * Rozdeli strom "node" na strom hodnot vetsich nez "value" a strom
+     * ostatnich hodnot. Puvodni strom se nemeni.
+     */
+    static void Split(const NodePtr_t &node, int value,
+                      NodePtr_t &greater, NodePtr_t &rest);
+
+    /**
+     * @brief Merge
+     * Spoji dva stromy, vsechny hodnoty "first" musi byt vetsi nebo rovny
+     * hodnotam "second". Puvodni stromy se nemeni.
+     * @return Vraci koren vysledneho stromu.
+     */
+    static NodePtr_t Merge(const NodePtr_t &first, const NodePtr_t &second);
+
+    /**
+     * @brief RemoveFirst
+     * @return Vraci strom "node" bez nejvetsi hodnoty.
+     */
+    static NodePtr_t RemoveFirst(const NodePtr_t &node);
+
+    std::atomic<Root_t *> m_pRoot;      ///< Zverejneny drzak korene fronty.
+    std::mutex m_writeMutex;            ///< Zamek serializujici zapisy.
+    uint32_t m_seed;                    ///< Stav generatoru priorit (chranen m_writeMutex).
+    std::vector<Root_t *> m_retired;    ///< Nahrazene drzaky (chraneny m_writeMutex).
+    mutable std::atomic<Root_t *> m_aHazards[MAX_THREADS]; ///< Drzaky chranene ctenari podle indexu vlakna.
+};
+
+#endif // SNAPSHOT_QUEUE_H_
@@ -0,0 +1,304 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - microbenchmark of PriorityQueue operations
+//
+// $NoKeywords: $ivs_project_1 $tdd_bench.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file tdd_bench.cpp
+ * @author Hung Do
+ *
+ * @brief Mereni doby jednotlivych operaci PriorityQueue v zavislosti na delce
+ * fronty (10 az max. delka, mocniny deseti) a rozlozeni hodnot. Pro kazdou
+ * kombinaci se meri ns/operaci, pocet alokaci (operator new) na operaci a,
+ * pokud to system dovoli (Linux perf_event_open), vypadky cache na operaci.
+ * Vysledky se vypisuji ve formatu JSON na standardni vystup.
+ *
+ * Pouziti: tdd_bench [max. delka fronty]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "tdd_bench_alloc.h"
+#include "tdd_code.h"
+
+namespace {
+
+/**
+ * Vysledky mereni, aby je prekladac nemohl vynechat.
+ */
+volatile long g_sink = 0;
+
+/**
+ * @brief The Distribution_t enum
+ * Rozlozeni hodnot, ze kterych se fronta sestavi a ktere se vkladaji.
+ */
+enum Distribution_t {
+    ASCENDING,      ///< Rostouci hodnoty, nove hodnoty patri na zacatek fronty.
+    DESCENDING,     ///< Klesajici hodnoty, nove hodnoty patri na konec fronty.
+    RANDOM,         ///< Nahodne hodnoty.
+    DUPLICATES,     ///< Nahodne hodnoty z 16 ruznych (mnoho stejnych hodnot).
+    DISTRIBUTIONS
+};
+
+const char *const DISTRIBUTION_NAMES[DISTRIBUTIONS] = {
+    "ascending", "descending", "random", "duplicates"
+};
+
+/**
+ * @brief Key
+ * @return Vraci i-tou hodnotu rozlozeni "distribution".
+ */
+int Key(Distribution_t distribution, size_t i, unsigned &seed)
+{
+    seed = seed * 1103515245 + 12345;
+    switch (distribution)
+    {
+    case ASCENDING:
+        return static_cast<int>(i);
+    case DESCENDING:
+        return -static_cast<int>(i);
+    case RANDOM:
+        return static_cast<int>(seed >> 1);
+    default:
+        return static_cast<int>((seed >> 16) % 16);
+    }
+}
+
+/**
+ * @brief The Meter class
+ * Scita cas, alokace a vypadky cache ve vsech usecich mezi Resume a Pause.
+ */
+class Meter
+{
+public:
+    Meter()
+        : m_fd(-1), m_nanoseconds(0), m_allocations(0)
+    {
+#if defined(__linux__)
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+        if (m_fd >= 0)
+            ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+#endif
+    }
+
+    ~Meter()
+    {
+#if defined(__linux__)
+        if (m_fd >= 0)
+            close(m_fd);
+#endif
+    }
+
+    Meter(const Meter &) = delete;
+    Meter &operator=(const Meter &) = delete;
+
+    void Resume()
+    {
+#if defined(__linux__)
+        if (m_fd >= 0)
+            ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+        m_allocationsBegin = AllocationCount();
+        m_begin = std::chrono::steady_clock::now();
+    }
+
+    void Pause()
+    {
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        m_allocations += AllocationCount() - m_allocationsBegin;
+#if defined(__linux__)
+        if (m_fd >= 0)
+            ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+        m_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_begin).count();
+    }
+
+    /**
+     * @brief CacheMisses
+     * @return Vraci pocet vypadku cache, nebo -1, pokud citac neni dostupny.
+     */
+    long long CacheMisses() const
+    {
+        long long count = -1;
+#if defined(__linux__)
+        if (m_fd < 0 || read(m_fd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count)))
+            count = -1;
+#endif
+        return count;
+    }
+
+    long long Nanoseconds() const
+    {
+        return m_nanoseconds;
+    }
+
+    unsigned long Allocations() const
+    {
+        return m_allocations;
+    }
+
+private:
+    int m_fd;
+    long long m_nanoseconds;
+    unsigned long m_allocations;
+    unsigned long m_allocationsBegin;
+    std::chrono::steady_clock::time_point m_begin;
+};
+
+/**
+ * @brief Report
+ * Vypise jeden vysledek jako objekt JSON.
+ */
+void Report(const char *operation, size_t size, Distribution_t distribution, size_t ops,
+            const Meter &meter)
+{
+    static bool first = true;
+    printf("%s\n    {\"operation\": \"%s\", \"size\": %zu, \"distribution\": \"%s\", "
+           "\"ops\": %zu, \"ns_per_op\": %.2f, \"allocs_per_op\": %.4f, \"cache_misses_per_op\": ",
+           first ? "" : ",", operation, size, DISTRIBUTION_NAMES[distribution], ops,
+           static_cast<double>(meter.Nanoseconds()) / ops,
+           static_cast<double>(meter.Allocations()) / ops);
+    long long misses = meter.CacheMisses();
+    if (misses >= 0)
+        printf("%.2f}", static_cast<double>(misses) / ops);
+    else
+        printf("null}");
+    first = false;
+}
+
+/**
+ * @brief Run
+ * Sestavi frontu delky "size" z hodnot rozlozeni "distribution" a zmeri
+ * vsechny operace.
+ */
+void Run(size_t size, Distribution_t distribution)
+{
+    unsigned seed = 42;
+    std::vector<int> keys(size);
+    for (size_t i = 0; i < size; i++)
+        keys[i] = Key(distribution, i, seed);
+
+    PriorityQueue queue;
+    queue.InsertMany(keys.data(), size);
+
+    // Pocet operaci klesa s delkou fronty (operace maji slozitost O(n)),
+    // meni se nanejvys o desetinu fronty, aby se jeji delka vyrazne nezmenila
+    size_t ops = 20000000 / size;
+    ops = ops < 16 ? 16 : (ops > 100000 ? 100000 : ops);
+    size_t batch = size / 10 > 16 ? size / 10 : 16;
+
+    // Nove hodnoty pokracuji v rozlozeni, existujici se vybiraji nahodne
+    std::vector<int> fresh(ops), existing(ops);
+    for (size_t i = 0; i < ops; i++)
+    {
+        fresh[i] = Key(distribution, size + i, seed);
+        seed = seed * 1103515245 + 12345;
+        existing[i] = keys[(seed >> 8) % size];
+    }
+
+    {
+        Meter meter;
+        for (size_t done = 0; done < ops; done += batch)
+        {
+            size_t count = ops - done < batch ? ops - done : batch;
+            meter.Resume();
+            for (size_t i = 0; i < count; i++)
+                queue.Insert(fresh[done + i]);
+            meter.Pause();
+            queue.RemoveMany(&fresh[done], count);
+        }
+        Report("Insert", size, distribution, ops, meter);
+    }
+
+    {
+        Meter meter;
+        std::vector<int> removed;
+        removed.reserve(batch);
+        for (size_t done = 0; done < ops; done += batch)
+        {
+            size_t count = ops - done < batch ? ops - done : batch;
+            removed.clear();
+            meter.Resume();
+            for (size_t i = 0; i < count; i++)
+            {
+                if (queue.Remove(existing[done + i]))
+                    removed.push_back(existing[done + i]);
+            }
+            meter.Pause();
+            queue.InsertMany(removed.data(), removed.size());
+        }
+        Report("Remove", size, distribution, ops, meter);
+    }
+
+    {
+        Meter meter;
+        meter.Resume();
+        for (size_t i = 0; i < ops; i++)
+            g_sink += queue.Find(existing[i]) != nullptr;
+        meter.Pause();
+        Report("Find", size, distribution, ops, meter);
+    }
+
+    {
+        Meter meter;
+        meter.Resume();
+        for (size_t i = 0; i < ops; i++)
+            g_sink += static_cast<long>(queue.Length());
+        meter.Pause();
+        Report("Length", size, distribution, ops, meter);
+    }
+
+    {
+        const size_t headOps = 1000000;
+        Meter meter;
+        meter.Resume();
+        for (size_t i = 0; i < headOps; i++)
+            g_sink += queue.GetHead()->value;
+        meter.Pause();
+        Report("GetHead", size, distribution, headOps, meter);
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    size_t maxSize = argc > 1 ? static_cast<size_t>(atol(argv[1])) : 10000000;
+
+    printf("{\n  \"benchmark\": \"tdd_bench\",\n  \"results\": [");
+    for (size_t size = 10; size <= maxSize; size *= 10)
+    {
+        for (int distribution = 0; distribution < DISTRIBUTIONS; distribution++)
+        {
+            Run(size, static_cast<Distribution_t>(distribution));
+            fflush(stdout);
+        }
+    }
+    printf("\n  ]\n}\n");
+    return 0;
+}
+
+/*** Konec souboru tdd_bench.cpp ***/
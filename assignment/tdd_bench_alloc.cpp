@@ -0,0 +1,50 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - allocation counter for tdd_bench
+//
+// $NoKeywords: $ivs_project_1 $tdd_bench_alloc.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file tdd_bench_alloc.cpp
+ * @author Hung Do
+ *
+ * @brief Nahrada globalniho operatoru new/delete, ktera pocita alokace.
+ */
+
+#include <stdlib.h>
+
+#include <new>
+
+#include "tdd_bench_alloc.h"
+
+namespace {
+
+/**
+ * Pocet alokaci provedenych pres operator new.
+ */
+unsigned long g_allocations = 0;
+
+} // namespace
+
+unsigned long AllocationCount()
+{
+    return g_allocations;
+}
+
+void *operator new(size_t size)
+{
+    g_allocations++;
+    void *memory = malloc(size > 0 ? size : 1);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void operator delete(void *memory) noexcept
+{
+    free(memory);
+}
+
+/*** Konec souboru tdd_bench_alloc.cpp ***/
@@ -0,0 +1,30 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - allocation counter for tdd_bench
+//
+// $NoKeywords: $ivs_project_1 $tdd_bench_alloc.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file tdd_bench_alloc.h
+ * @author Hung Do
+ *
+ * @brief Pocitadlo alokaci pro mereni v tdd_bench.
+ */
+
+#pragma once
+
+#ifndef TDD_BENCH_ALLOC_H_
+#define TDD_BENCH_ALLOC_H_
+
+/**
+ * @brief AllocationCount
+ * Vraci pocet alokaci provedenych pres globalni operator new od spusteni
+ * programu. Operatory jsou nahrazeny v tdd_bench_alloc.cpp, tedy v jine
+ * prekladove jednotce nez kod, ktery je vola, takze prekladac pri vkladani
+ * funkci nevidi malloc/free sparovane s new/delete.
+ */
+unsigned long AllocationCount();
+
+#endif // TDD_BENCH_ALLOC_H_
@@ -16,6 +16,10 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
 #include "tdd_code.h"
 
 //============================================================================//
@@ -39,28 +43,37 @@ PriorityQueue::PriorityQueue()
 
 PriorityQueue::~PriorityQueue()
 {
-    if (m_pHead != nullptr)
+    // Polozky uvolni alokator po celych blocich (destruktor m_pool)
+    m_pHead = nullptr;
+}
+
+PriorityQueue::PriorityQueue(PriorityQueue &&other)
+{
+    m_pHead = other.m_pHead;
+    other.m_pHead = nullptr;
+    m_pool.Swap(other.m_pool);
+}
+
+PriorityQueue &PriorityQueue::operator=(PriorityQueue &&other)
+{
+    if (&other != this)
     {
-        Element_t *temp = m_pHead;
-        while (m_pHead != nullptr)
-        {
-            m_pHead = m_pHead->pNext;
-            delete temp;
-            temp = m_pHead;
-        }
+        // Vlastni polozky se uvolni spolu s bloky alokatoru
+        m_pool.Clear();
+        m_pool.Swap(other.m_pool);
+        m_pHead = other.m_pHead;
+        other.m_pHead = nullptr;
     }
+    return *this;
 }
 
 
 void PriorityQueue::Insert(int value)
 {
     // Inicializace elementu
-    Element_t *element = new Element_t;
-    if (element != nullptr)
-    {
-        element->pNext = nullptr;
-        element->value = value;
-    }
+    Element_t *element = m_pool.Allocate();
+    element->pNext = nullptr;
+    element->value = value;
 
     // Prazdna fronta
     if (m_pHead == nullptr)
@@ -100,7 +113,7 @@ bool PriorityQueue::Remove(int value)
         if (m_pHead->value == value)
         {
             Element_t *temp = m_pHead->pNext;
-            delete m_pHead;
+            m_pool.Release(m_pHead);
             m_pHead = temp;
             return true;
         }
@@ -117,7 +130,7 @@ bool PriorityQueue::Remove(int value)
             {
                 Element_t *temp = curr->pNext;
                 curr->pNext = temp->pNext;
-                delete temp;
+                m_pool.Release(temp);
                 return true;
             }
         }
@@ -125,6 +138,117 @@ bool PriorityQueue::Remove(int value)
     return false;
 }
 
+void PriorityQueue::InsertMany(const int *values, size_t count)
+{
+    // Serazeni vkladanych hodnot od max po min
+    std::vector<int> sorted(values, values + count);
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+
+    // Vsechny nove polozky se vykroji z jednoho bloku
+    m_pool.Reserve(count);
+
+    // Slouceni serazenych hodnot s frontou, "link" ukazuje na odkaz, za
+    // ktery se vklada (pred polozky se stejnou hodnotou jako Insert)
+    Element_t **link = &m_pHead;
+    for (size_t i = 0; i < sorted.size(); i++)
+    {
+        while (*link != nullptr && (*link)->value > sorted[i])
+            link = &(*link)->pNext;
+
+        Element_t *element = m_pool.Allocate();
+        element->value = sorted[i];
+        element->pNext = *link;
+        *link = element;
+        link = &element->pNext;
+    }
+}
+
+size_t PriorityQueue::RemoveMany(const int *values, size_t count)
+{
+    std::vector<int> sorted(values, values + count);
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+
+    size_t removed = 0;
+    Element_t **link = &m_pHead;
+    for (size_t i = 0; i < sorted.size(); i++)
+    {
+        while (*link != nullptr && (*link)->value > sorted[i])
+            link = &(*link)->pNext;
+
+        // Hodnota ve fronte neni, pokracuje se dalsi hodnotou
+        if (*link == nullptr || (*link)->value != sorted[i])
+            continue;
+
+        Element_t *temp = *link;
+        *link = temp->pNext;
+        m_pool.Release(temp);
+        removed++;
+    }
+    return removed;
+}
+
+void PriorityQueue::Meld(PriorityQueue &&other)
+{
+    if (&other == this)
+        return;
+
+    // Slouceni dvou serazenych seznamu prepojenim polozek, polozky z "other"
+    // se stejne jako v Insert zaradi pred polozky se stejnou hodnotou
+    Element_t **link = &m_pHead;
+    Element_t *element = other.m_pHead;
+    while (element != nullptr)
+    {
+        while (*link != nullptr && (*link)->value > element->value)
+            link = &(*link)->pNext;
+
+        if (*link == nullptr)
+        {
+            // Zbytek "other" se pripoji na konec fronty najednou
+            *link = element;
+            break;
+        }
+
+        Element_t *next = element->pNext;
+        element->pNext = *link;
+        *link = element;
+        link = &element->pNext;
+        element = next;
+    }
+
+    other.m_pHead = nullptr;
+    m_pool.Steal(other.m_pool);
+}
+
+void PriorityQueue::Swap(PriorityQueue &other)
+{
+    Element_t *temp = m_pHead;
+    m_pHead = other.m_pHead;
+    other.m_pHead = temp;
+    m_pool.Swap(other.m_pool);
+}
+
+PriorityQueue PriorityQueue::Clone() const
+{
+    size_t length = 0;
+    for (Element_t *temp = m_pHead; temp != nullptr; temp = temp->pNext)
+        length++;
+
+    // Vsechny polozky kopie se vykroji z jednoho bloku
+    PriorityQueue clone;
+    clone.m_pool.Reserve(length);
+
+    Element_t **link = &clone.m_pHead;
+    for (Element_t *temp = m_pHead; temp != nullptr; temp = temp->pNext)
+    {
+        Element_t *element = clone.m_pool.Allocate();
+        element->value = temp->value;
+        *link = element;
+        link = &element->pNext;
+    }
+    *link = nullptr;
+    return clone;
+}
+
 PriorityQueue::Element_t *PriorityQueue::Find(int value)
 {
     // Hledani elementu ve fronte
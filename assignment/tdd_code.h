@@ -18,12 +18,18 @@
 #ifndef TDD_CODE_H_
 #define TDD_CODE_H_
 
+#include <stddef.h>
+
+#include "slab_pool.h"
+
 /**
  * @brief The PriorityQueue class
  * Prioritni fronta (polozky vzdy serazeny od max po min) implementovana pomoci
  * tzv. linked listu (kazda polozka ma odkaz na  nasledujici polozku).
  * Dale ma kazda polozka hodnotu typu "int", pricemz fronta muze obsahovat vice
  * polozek se stejnou hodnotou.
+ * Polozky jsou alokovany z bloku alokatoru vlastneneho frontou, odstranene
+ * polozky se znovu pouziji pri dalsim vkladani.
  */
 class PriorityQueue
 {
@@ -36,10 +42,31 @@ public:
 
     /**
      * @brief ~PriorityQueue
-     * Destruktor, odstrani vsechny polozky i frontu samotnou.
+     * Destruktor, odstrani vsechny polozky i frontu samotnou. Polozky se
+     * neuvolnuji jednotlive, ale po celych blocich alokatoru.
      */
     ~PriorityQueue();
 
+    PriorityQueue(const PriorityQueue &) = delete;
+    PriorityQueue &operator=(const PriorityQueue &) = delete;
+
+    /**
+     * @brief PriorityQueue
+     * Presunovaci konstruktor, prevezme polozky (i bloky alokatoru) fronty
+     * "other", ktera zustane prazdna. Ukazatele na polozky zustavaji platne.
+     * @param other Fronta, jejiz polozky budou prevzaty.
+     */
+    PriorityQueue(PriorityQueue &&other);
+
+    /**
+     * @brief operator =
+     * Presunovaci prirazeni, odstrani vlastni polozky a prevezme polozky (i
+     * bloky alokatoru) fronty "other", ktera zustane prazdna.
+     * @param other Fronta, jejiz polozky budou prevzaty.
+     * @return Vraci referenci na tuto frontu.
+     */
+    PriorityQueue &operator=(PriorityQueue &&other);
+
     /**
      * @brief The Element_t struct
      * Struktura polozky ve fronte.
@@ -69,6 +96,53 @@ public:
      */
     bool Remove(int value);
 
+    /**
+     * @brief InsertMany
+     * Zaradi "count" novych polozek s hodnotami z pole "values" do fronty.
+     * Hodnoty se nejprve seradi a pote se jednim pruchodem slouci s frontou,
+     * slozitost je tedy O(n + m log m) misto O(n * m) pri opakovanem volani
+     * metody Insert. Poradi vuci polozkam se stejnou hodnotou odpovida Insert.
+     * @param values Pole hodnot novych polozek.
+     * @param count Pocet hodnot v poli "values".
+     */
+    void InsertMany(const int *values, size_t count);
+
+    /**
+     * @brief RemoveMany
+     * Odstrani z fronty pro kazdou hodnotu z pole "values" jednu polozku s
+     * touto hodnotou (stejne jako Remove). Hodnoty se nejprve seradi a pote se
+     * vsechny odstrani jednim pruchodem frontou.
+     * @param values Pole hodnot odstranovanych polozek.
+     * @param count Pocet hodnot v poli "values".
+     * @return Vrati pocet skutecne odstranenych polozek.
+     */
+    size_t RemoveMany(const int *values, size_t count);
+
+    /**
+     * @brief Meld
+     * Presune vsechny polozky fronty "other" do teto fronty, "other" zustane
+     * prazdna. Oba serazene seznamy se slouci jednim pruchodem (O(n + m)),
+     * polozky se nekopiruji ani nealokuji znovu, tato fronta prevezme bloky
+     * alokatoru fronty "other". Ukazatele na polozky zustavaji platne.
+     * @param other Fronta, jejiz polozky budou presunuty.
+     */
+    void Meld(PriorityQueue &&other);
+
+    /**
+     * @brief Swap
+     * Prohodi obsah dvou front v case O(1), polozky se nepresouvaji.
+     * @param other Druha fronta.
+     */
+    void Swap(PriorityQueue &other);
+
+    /**
+     * @brief Clone
+     * Vytvori hlubokou kopii fronty. Vsechny polozky kopie jsou alokovany z
+     * jednoho souvisleho bloku v poradi fronty.
+     * @return Vraci novou frontu se stejnymi hodnotami.
+     */
+    PriorityQueue Clone() const;
+
     /**
      * @brief Find
      * Nalezne libovolnou polozku s hodnotou "value" a vrati ukazatel na tuto polozku,
@@ -88,14 +162,26 @@ public:
     /**
      * @brief GetHead
      * Vraci ukazatel na prvni polozku ve fronte, ktera je vzdy zaroven polozkou
-     * s nejmensi hodnotou.
-     * @return Vraci ukazatel na 1./nejmensi polozku fronty, nebo NULL, pokud je
+     * s nejvetsi hodnotou. Nejmensi polozka je na konci seznamu, pro pristup
+     * k obema koncum fronty v case O(1) slouzi MinMaxHeap.
+     * @return Vraci ukazatel na 1./nejvetsi polozku fronty, nebo NULL, pokud je
      * fronta prazdna.
      */
     Element_t *GetHead();
 
 protected:
     Element_t *m_pHead;     ///< Ukazatel na zacatek fronty.
+
+    SlabPool<Element_t> m_pool; ///< Alokator polozek fronty.
 };
 
+/**
+ * @brief swap
+ * Prohodi obsah dvou front (pro std::swap a genericky kod).
+ */
+inline void swap(PriorityQueue &first, PriorityQueue &second)
+{
+    first.Swap(second);
+}
+
 #endif // TDD_CODE_H_
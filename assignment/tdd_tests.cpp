@@ -13,8 +13,41 @@
  * @brief Testy implementace prioritni fronty.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "tdd_code.h"
+#include "heap_queue.h"
+#include "skip_list_queue.h"
+#include "concurrent_queue.h"
+#include "multi_queue.h"
+#include "pairing_heap.h"
+#include "bucket_queue.h"
+#include "min_max_heap.h"
+#include "unrolled_queue.h"
+#include "snapshot_queue.h"
+#include "run_length_queue.h"
+#include "blocking_queue.h"
+#include "timer_wheel.h"
+#include "bounded_queue.h"
+#include "indexed_queue.h"
+#include "external_queue.h"
+#include "bitmap_queue.h"
+#if defined(__unix__) || defined(__APPLE__)
+#include <stdio.h>
+#include "mapped_queue.h"
+#endif
 
 class NonEmptyQueue : public ::testing::Test
 {
@@ -102,6 +135,159 @@ TEST_F(NonEmptyQueue, Length)
     EXPECT_EQ(queue.Length(), 14);
 }
 
+TEST_F(NonEmptyQueue, ReuseRemoved)
+{
+    PriorityQueue::Element_t *pElem = queue.Find(50);
+    ASSERT_TRUE(pElem != NULL);
+    EXPECT_TRUE(queue.Remove(50));
+
+    queue.Insert(45);
+    EXPECT_EQ(queue.Find(45), pElem);
+    EXPECT_EQ(queue.Length(), 14);
+
+    for(int i = 0; i < 1000; ++i)
+        queue.Insert(i % 100);
+    for(int i = 0; i < 1000; ++i)
+        EXPECT_TRUE(queue.Remove(i % 100));
+
+    EXPECT_EQ(queue.Length(), 14);
+    EXPECT_EQ(queue.GetHead()->value, 90);
+}
+
+TEST_F(NonEmptyQueue, InsertMany)
+{
+    int values[] = { 100, 0, 55, 55, 42, 90 };
+    queue.InsertMany(values, 6);
+
+    EXPECT_EQ(queue.Length(), 20);
+    EXPECT_EQ(queue.GetHead()->value, 100);
+
+    int expected[] = { 100, 90, 90, 85, 80, 70, 65, 60, 55, 55, 55, 50, 42,
+                       40, 30, 20, 15, 10, 5, 0 };
+    PriorityQueue::Element_t *pElem = queue.GetHead();
+    for(int i = 0; i < 20; ++i)
+    {
+        ASSERT_TRUE(pElem != NULL);
+        EXPECT_EQ(pElem->value, expected[i]);
+        pElem = pElem->pNext;
+    }
+    EXPECT_TRUE(pElem == NULL);
+}
+
+TEST_F(NonEmptyQueue, RemoveMany)
+{
+    int values[] = { 5, 90, 0, 55, 55, 42, 60 };
+    EXPECT_EQ(queue.RemoveMany(values, 7), 4);
+    EXPECT_EQ(queue.Length(), 10);
+    EXPECT_EQ(queue.GetHead()->value, 85);
+    EXPECT_TRUE(queue.Find(55) == NULL);
+    EXPECT_TRUE(queue.Find(5) == NULL);
+
+    int rest[] = { 85, 80, 70, 65, 50, 40, 30, 20, 15, 10 };
+    EXPECT_EQ(queue.RemoveMany(rest, 10), 10);
+    EXPECT_TRUE(queue.GetHead() == NULL);
+}
+
+TEST_F(NonEmptyQueue, Meld)
+{
+    PriorityQueue other;
+    int values[] = { 100, 55, 55, 42, 0 };
+    other.InsertMany(values, 5);
+    other.Remove(42);
+    PriorityQueue::Element_t *pElem = other.Find(100);
+
+    queue.Meld(std::move(other));
+    EXPECT_TRUE(other.GetHead() == NULL);
+    EXPECT_EQ(queue.Length(), 18);
+    EXPECT_EQ(queue.GetHead(), pElem);
+
+    int expected[] = { 100, 90, 85, 80, 70, 65, 60, 55, 55, 55, 50, 40, 30,
+                       20, 15, 10, 5, 0 };
+    pElem = queue.GetHead();
+    for(int i = 0; i < 18; ++i)
+    {
+        ASSERT_TRUE(pElem != NULL);
+        EXPECT_EQ(pElem->value, expected[i]);
+        pElem = pElem->pNext;
+    }
+    EXPECT_TRUE(pElem == NULL);
+
+    // Obe fronty zustavaji pouzitelne
+    other.Insert(7);
+    EXPECT_EQ(other.Length(), 1);
+    queue.Meld(std::move(queue));
+    EXPECT_EQ(queue.Length(), 18);
+    EXPECT_EQ(queue.RemoveMany(expected, 18), 18);
+    EXPECT_TRUE(queue.GetHead() == NULL);
+}
+
+TEST_F(NonEmptyQueue, MoveAndSwap)
+{
+    PriorityQueue::Element_t *pHead = queue.GetHead();
+
+    PriorityQueue moved(std::move(queue));
+    EXPECT_TRUE(queue.GetHead() == NULL);
+    EXPECT_EQ(moved.GetHead(), pHead);
+    EXPECT_EQ(moved.Length(), 14);
+
+    PriorityQueue other;
+    other.Insert(1);
+    other = std::move(moved);
+    EXPECT_EQ(other.GetHead(), pHead);
+    EXPECT_EQ(other.Length(), 14);
+    EXPECT_TRUE(moved.GetHead() == NULL);
+
+    // Presunuta fronta zustava pouzitelna
+    queue.Insert(3);
+    swap(queue, other);
+    EXPECT_EQ(queue.GetHead(), pHead);
+    EXPECT_EQ(other.GetHead()->value, 3);
+    EXPECT_EQ(other.Length(), 1);
+    EXPECT_TRUE(queue.Remove(90));
+    EXPECT_EQ(queue.Length(), 13);
+}
+
+TEST_F(NonEmptyQueue, Clone)
+{
+    PriorityQueue clone = queue.Clone();
+    EXPECT_EQ(clone.Length(), 14);
+
+    // Polozky kopie jsou nove a lezi v pameti za sebou
+    PriorityQueue::Element_t *pElem = queue.GetHead();
+    PriorityQueue::Element_t *pClone = clone.GetHead();
+    for(int i = 0; i < 14; ++i)
+    {
+        ASSERT_TRUE(pClone != NULL);
+        EXPECT_NE(pClone, pElem);
+        EXPECT_EQ(pClone->value, pElem->value);
+        if(pClone->pNext != NULL)
+        {
+            EXPECT_EQ(pClone->pNext, pClone + 1);
+        }
+        pElem = pElem->pNext;
+        pClone = pClone->pNext;
+    }
+    EXPECT_TRUE(pClone == NULL);
+
+    // Zmena kopie neovlivni puvodni frontu
+    EXPECT_TRUE(clone.Remove(90));
+    EXPECT_EQ(queue.GetHead()->value, 90);
+    EXPECT_TRUE(PriorityQueue().Clone().GetHead() == NULL);
+}
+
+TEST_F(EmptyQueue, InsertMany)
+{
+    queue.InsertMany(NULL, 0);
+    EXPECT_TRUE(queue.GetHead() == NULL);
+
+    int values[] = { 3, 1, 2 };
+    queue.InsertMany(values, 3);
+    EXPECT_EQ(queue.Length(), 3);
+    EXPECT_EQ(queue.GetHead()->value, 3);
+    EXPECT_EQ(queue.GetHead()->pNext->value, 2);
+    EXPECT_EQ(queue.RemoveMany(values, 3), 3);
+    EXPECT_EQ(queue.Length(), 0);
+}
 
 TEST_F(EmptyQueue, Insert)
 {
@@ -131,4 +317,1509 @@ TEST_F(EmptyQueue, Length)
     EXPECT_EQ(queue.Length(), 0);
 }
 
+class NonEmptyHeapQueue : public ::testing::Test
+{
+protected:
+    virtual void SetUp() {
+        int values[] = { 10, 85, 15, 70, 20, 60, 30, 50, 65, 80, 90, 40, 5, 55 };
+
+        for(int i = 0; i < 14; ++i)
+            queue.Insert(values[i]);
+    }
+
+    HeapPriorityQueue queue;
+};
+
+TEST(EmptyHeapQueue, Operations)
+{
+    HeapPriorityQueue queue;
+
+    EXPECT_TRUE(queue.GetTop() == NULL);
+    EXPECT_FALSE(queue.PopTop());
+    EXPECT_FALSE(queue.Remove(0));
+    EXPECT_FALSE(queue.Find(0));
+    EXPECT_EQ(queue.Length(), 0);
+
+    queue.Insert(0);
+    ASSERT_TRUE(queue.GetTop() != NULL);
+    EXPECT_EQ(*queue.GetTop(), 0);
+    EXPECT_EQ(queue.Length(), 1);
+}
+
+TEST_F(NonEmptyHeapQueue, PopTop)
+{
+    int values[] = { 90, 85, 80, 70, 65, 60, 55, 50, 40, 30, 20, 15, 10, 5 };
+    for(int i = 0; i < 14; ++i)
+    {
+        int value;
+        ASSERT_TRUE(queue.PopTop(value));
+        EXPECT_EQ(value, values[i]);
+        EXPECT_EQ(queue.Length(), 13 - i);
+    }
+
+    EXPECT_TRUE(queue.GetTop() == NULL);
+    EXPECT_FALSE(queue.PopTop());
+}
+
+TEST_F(NonEmptyHeapQueue, RemoveAndFind)
+{
+    EXPECT_FALSE(queue.Remove(0));
+    EXPECT_TRUE(queue.Find(55));
+    EXPECT_TRUE(queue.Remove(55));
+    EXPECT_FALSE(queue.Find(55));
+    EXPECT_TRUE(queue.Remove(90));
+    EXPECT_EQ(*queue.GetTop(), 85);
+
+    queue.Insert(85);
+    EXPECT_TRUE(queue.Remove(85));
+    EXPECT_TRUE(queue.Find(85));
+
+    int values[] = { 85, 80, 70, 65, 60, 50, 40, 30, 20, 15, 10, 5 };
+    for(int i = 0; i < 12; ++i)
+    {
+        int value;
+        ASSERT_TRUE(queue.PopTop(value));
+        EXPECT_EQ(value, values[i]);
+    }
+}
+
+struct Task_t {
+    int priority;
+    std::unique_ptr<std::string> name;
+
+    Task_t(int priority, const char *name) : priority(priority), name(new std::string(name)) {}
+};
+
+struct TaskCompare {
+    bool operator()(const Task_t &a, const Task_t &b) const { return a.priority < b.priority; }
+};
+
+TEST(BasicPriorityQueue, MoveOnlyPayload)
+{
+    BasicPriorityQueue<Task_t, TaskCompare> queue;
+
+    queue.Emplace(20, "b");
+    queue.Emplace(30, "a");
+    queue.Insert(Task_t(10, "c"));
+    queue.Emplace(25, "x");
+    EXPECT_EQ(queue.Length(), 4);
+
+    ASSERT_TRUE(queue.GetTop() != NULL);
+    EXPECT_EQ(*queue.GetTop()->name, "a");
+
+    Task_t task(0, "");
+    const char *expected[] = { "a", "x", "b", "c" };
+    for(int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.PopTop(task));
+        EXPECT_EQ(*task.name, expected[i]);
+    }
+    EXPECT_FALSE(queue.PopTop(task));
+}
+
+TEST(BasicPriorityQueue, CustomCompare)
+{
+    BasicPriorityQueue<int, std::greater<int> > queue(16);
+
+    int values[] = { 10, 85, 15, 70, 20, 60, 30, 50, 65, 80, 90, 40, 5, 55 };
+    for(int i = 0; i < 14; ++i)
+        queue.Insert(values[i]);
+
+    EXPECT_EQ(*queue.GetTop(), 5);
+    EXPECT_TRUE(queue.Remove(5));
+    EXPECT_TRUE(queue.Remove(50));
+
+    int expected[] = { 10, 15, 20, 30, 40, 55, 60, 65, 70, 80, 85, 90 };
+    for(int i = 0; i < 12; ++i)
+    {
+        int value;
+        ASSERT_TRUE(queue.PopTop(value));
+        EXPECT_EQ(value, expected[i]);
+    }
+}
+
+class NonEmptySkipListQueue : public ::testing::Test
+{
+protected:
+    virtual void SetUp() {
+        int values[] = { 10, 85, 15, 70, 20, 60, 30, 50, 65, 80, 90, 40, 5, 55 };
+
+        for(int i = 0; i < 14; ++i)
+            queue.Insert(values[i]);
+    }
+
+    SkipListPriorityQueue queue;
+};
+
+TEST(EmptySkipListQueue, Operations)
+{
+    SkipListPriorityQueue queue;
+
+    EXPECT_TRUE(queue.GetHead() == NULL);
+    EXPECT_FALSE(queue.Remove(0));
+    EXPECT_TRUE(queue.Find(0) == NULL);
+    EXPECT_EQ(queue.Length(), 0);
+
+    queue.Insert(0);
+    ASSERT_TRUE(queue.GetHead() != NULL);
+    EXPECT_EQ(queue.GetHead()->value, 0);
+    EXPECT_EQ(queue.Length(), 1);
+}
+
+TEST_F(NonEmptySkipListQueue, Traversal)
+{
+    int values[] = { 90, 85, 80, 70, 65, 60, 55, 50, 40, 30, 20, 15, 10, 5 };
+    SkipListPriorityQueue::Element_t *pElem = queue.GetHead();
+    for(int i = 0; i < 14; ++i)
+    {
+        ASSERT_TRUE(pElem != NULL);
+        EXPECT_EQ(pElem->value, values[i]);
+        pElem = pElem->pNext;
+    }
+    EXPECT_TRUE(pElem == NULL);
+}
+
+TEST_F(NonEmptySkipListQueue, FindAndRemove)
+{
+    int values[] = { 5, 10, 15, 20, 30, 40, 50, 55, 60, 65, 70, 80, 85, 90 };
+    for(int i = 0; i < 14; ++i)
+    {
+        SkipListPriorityQueue::Element_t *pElem = queue.Find(values[i]);
+        ASSERT_TRUE(pElem != NULL);
+        EXPECT_EQ(pElem->value, values[i]);
+    }
+    EXPECT_TRUE(queue.Find(0) == NULL);
+    EXPECT_TRUE(queue.Find(100) == NULL);
+    EXPECT_TRUE(queue.Find(52) == NULL);
+
+    EXPECT_FALSE(queue.Remove(0));
+    for(int i = 0; i < 13; ++i)
+    {
+        EXPECT_TRUE(queue.Remove(values[i]));
+        EXPECT_EQ(queue.GetHead()->value, 90);
+        EXPECT_EQ(queue.Length(), 13 - i);
+    }
+    EXPECT_TRUE(queue.Remove(90));
+    EXPECT_TRUE(queue.GetHead() == NULL);
+}
+
+TEST_F(NonEmptySkipListQueue, ManyDuplicates)
+{
+    for(int i = 0; i < 5000; ++i)
+        queue.Insert((i * 7919) % 100);
+    EXPECT_EQ(queue.Length(), 5014);
+
+    for(int i = 0; i < 5000; ++i)
+        EXPECT_TRUE(queue.Remove((i * 7919) % 100));
+
+    int values[] = { 90, 85, 80, 70, 65, 60, 55, 50, 40, 30, 20, 15, 10, 5 };
+    SkipListPriorityQueue::Element_t *pElem = queue.GetHead();
+    for(int i = 0; i < 14; ++i)
+    {
+        ASSERT_TRUE(pElem != NULL);
+        EXPECT_EQ(pElem->value, values[i]);
+        pElem = pElem->pNext;
+    }
+    EXPECT_TRUE(pElem == NULL);
+}
+
+TEST(ConcurrentQueue, Sequential)
+{
+    ConcurrentPriorityQueue queue;
+    int value;
+
+    EXPECT_FALSE(queue.PopMax(value));
+    EXPECT_EQ(queue.Length(), 0);
+
+    for(int i = 0; i < 1000; ++i)
+        queue.Insert((i * 7919) % 1000);
+    EXPECT_EQ(queue.Length(), 1000);
+
+    for(int i = 999; i >= 0; --i)
+    {
+        ASSERT_TRUE(queue.PopMax(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.PopMax(value));
+    EXPECT_EQ(queue.Length(), 0);
+
+    queue.Insert(5);
+    ASSERT_TRUE(queue.PopMax(value));
+    EXPECT_EQ(value, 5);
+}
+
+TEST(ConcurrentQueue, Stress)
+{
+    const int THREADS = 4;
+    const int OPERATIONS = 20000;
+
+    ConcurrentPriorityQueue queue;
+    std::vector<int> popped[THREADS];
+    std::vector<std::thread> threads;
+
+    for(int t = 0; t < THREADS; ++t)
+    {
+        threads.push_back(std::thread([&queue, &popped, t]() {
+            unsigned seed = 12345 + t;
+            for(int i = 0; i < OPERATIONS; ++i)
+            {
+                seed = seed * 1103515245 + 12345;
+                queue.Insert(static_cast<int>((seed >> 8) % 10000));
+
+                int value;
+                if((i % 3) != 0 && queue.PopMax(value))
+                    popped[t].push_back(value);
+            }
+        }));
+    }
+    for(int t = 0; t < THREADS; ++t)
+        threads[t].join();
+
+    // Kazda vlozena hodnota musi byt odebrana prave jednou
+    std::vector<int> expected;
+    std::vector<int> actual;
+    for(int t = 0; t < THREADS; ++t)
+    {
+        unsigned seed = 12345 + t;
+        for(int i = 0; i < OPERATIONS; ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            expected.push_back(static_cast<int>((seed >> 8) % 10000));
+        }
+        actual.insert(actual.end(), popped[t].begin(), popped[t].end());
+    }
+
+    EXPECT_EQ(queue.Length(), expected.size() - actual.size());
+
+    int value;
+    int last = 10000;
+    while(queue.PopMax(value))
+    {
+        EXPECT_LE(value, last);
+        last = value;
+        actual.push_back(value);
+    }
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    EXPECT_TRUE(expected == actual);
+}
+
+TEST(MultiQueue, Sequential)
+{
+    MultiQueue queue(2, 2, true);
+    int value;
+
+    EXPECT_EQ(queue.ShardCount(), 4);
+    EXPECT_FALSE(queue.PopMax(value));
+    EXPECT_TRUE(queue.GetHead(4) == NULL);
+
+    for(int i = 0; i < 1000; ++i)
+        queue.Insert(i);
+    EXPECT_EQ(queue.Length(), 1000);
+
+    // Kazda dilci fronta je serazena od max po min
+    for(size_t shard = 0; shard < queue.ShardCount(); ++shard)
+    {
+        for(PriorityQueue::Element_t *pElem = queue.GetHead(shard);
+            pElem != NULL && pElem->pNext != NULL; pElem = pElem->pNext)
+            EXPECT_GE(pElem->value, pElem->pNext->value);
+    }
+
+    std::vector<int> popped;
+    while(queue.PopMax(value))
+        popped.push_back(value);
+    EXPECT_EQ(queue.Length(), 0);
+    ASSERT_EQ(popped.size(), 1000);
+
+    std::sort(popped.begin(), popped.end());
+    for(int i = 0; i < 1000; ++i)
+        EXPECT_EQ(popped[i], i);
+
+    MultiQueue::Stats_t stats = queue.GetStats();
+    EXPECT_EQ(stats.pops, 1000);
+    EXPECT_GE(stats.meanRankError, 0.0);
+    EXPECT_LT(stats.meanRankError, 100.0);
+    EXPECT_GE(stats.maxRankError, stats.meanRankError);
+}
+
+TEST(MultiQueue, Concurrent)
+{
+    const int THREADS = 4;
+    const int OPERATIONS = 5000;
+
+    MultiQueue queue(THREADS);
+    std::vector<int> popped[THREADS];
+    std::vector<std::thread> threads;
+
+    for(int t = 0; t < THREADS; ++t)
+    {
+        threads.push_back(std::thread([&queue, &popped, t]() {
+            for(int i = 0; i < OPERATIONS; ++i)
+            {
+                queue.Insert(i * THREADS + t);
+
+                int value;
+                if((i % 2) != 0 && queue.PopMax(value))
+                    popped[t].push_back(value);
+            }
+        }));
+    }
+    for(int t = 0; t < THREADS; ++t)
+        threads[t].join();
+
+    std::vector<int> actual;
+    for(int t = 0; t < THREADS; ++t)
+        actual.insert(actual.end(), popped[t].begin(), popped[t].end());
+    EXPECT_EQ(queue.Length(), THREADS * OPERATIONS - actual.size());
+
+    int value;
+    while(queue.PopMax(value))
+        actual.push_back(value);
+
+    std::sort(actual.begin(), actual.end());
+    ASSERT_EQ(actual.size(), THREADS * OPERATIONS);
+    for(int i = 0; i < THREADS * OPERATIONS; ++i)
+        EXPECT_EQ(actual[i], i);
+    EXPECT_EQ(queue.GetStats().pops, 0);
+}
+
+TEST(PairingHeap, Handles)
+{
+    PairingHeap heap;
+    int value;
+
+    EXPECT_TRUE(heap.GetTop() == NULL);
+    EXPECT_FALSE(heap.PopTop());
+
+    PairingHeap::Handle_t a = heap.Insert(10);
+    PairingHeap::Handle_t b = heap.Insert(20);
+    PairingHeap::Handle_t c = heap.Insert(30);
+    PairingHeap::Handle_t d = heap.Insert(20);
+    EXPECT_EQ(heap.Length(), 4);
+    EXPECT_EQ(heap.GetTop(), c);
+
+    // Zvyseni a snizeni hodnoty
+    heap.UpdatePriority(a, 40);
+    EXPECT_EQ(heap.GetTop(), a);
+    heap.UpdatePriority(a, 5);
+    EXPECT_EQ(heap.GetTop(), c);
+    EXPECT_EQ(a->value, 5);
+
+    // Odstrani se presne zadana polozka, ne libovolna se stejnou hodnotou
+    heap.Erase(d);
+    EXPECT_EQ(heap.Length(), 3);
+    heap.Erase(c);
+    EXPECT_EQ(heap.GetTop(), b);
+
+    ASSERT_TRUE(heap.PopTop(value));
+    EXPECT_EQ(value, 20);
+    ASSERT_TRUE(heap.PopTop(value));
+    EXPECT_EQ(value, 5);
+    EXPECT_FALSE(heap.PopTop(value));
+    EXPECT_EQ(heap.Length(), 0);
+}
+
+TEST(PairingHeap, RandomUpdates)
+{
+    PairingHeap heap;
+    std::vector<PairingHeap::Handle_t> handles;
+
+    unsigned seed = 42;
+    for(int i = 0; i < 2000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        handles.push_back(heap.Insert((seed >> 8) % 1000));
+    }
+
+    for(int i = 0; i < 2000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        size_t index = (seed >> 8) % handles.size();
+        seed = seed * 1103515245 + 12345;
+        if((i % 4) == 0)
+        {
+            heap.Erase(handles[index]);
+            handles[index] = handles.back();
+            handles.pop_back();
+        }
+        else
+            heap.UpdatePriority(handles[index], (seed >> 8) % 1000);
+    }
+    EXPECT_EQ(heap.Length(), handles.size());
+
+    std::vector<int> expected;
+    for(size_t i = 0; i < handles.size(); ++i)
+        expected.push_back(handles[i]->value);
+    std::sort(expected.rbegin(), expected.rend());
+
+    int value;
+    for(size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_TRUE(heap.PopTop(value));
+        EXPECT_EQ(value, expected[i]);
+    }
+    EXPECT_FALSE(heap.PopTop());
+}
+
+TEST(PairingHeap, Meld)
+{
+    PairingHeap heap, other, empty;
+    PairingHeap::Handle_t a = heap.Insert(10);
+    heap.Insert(30);
+    PairingHeap::Handle_t b = other.Insert(20);
+    other.Insert(40);
+    other.Erase(other.Insert(50));
+
+    heap.Meld(std::move(empty));
+    EXPECT_EQ(heap.Length(), 2);
+    heap.Meld(std::move(other));
+    EXPECT_EQ(heap.Length(), 4);
+    EXPECT_EQ(other.Length(), 0);
+    EXPECT_TRUE(other.GetTop() == NULL);
+    EXPECT_EQ(heap.GetTop()->value, 40);
+
+    // Odkazy z obou hald zustavaji platne
+    heap.UpdatePriority(b, 45);
+    EXPECT_EQ(heap.GetTop(), b);
+    heap.Erase(a);
+
+    empty.Meld(std::move(heap));
+    int expected[] = { 45, 40, 30 };
+    int value;
+    for(int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(empty.PopTop(value));
+        EXPECT_EQ(value, expected[i]);
+    }
+    EXPECT_FALSE(empty.PopTop());
+}
+
+class NonEmptyBucketQueue : public ::testing::Test
+{
+protected:
+    NonEmptyBucketQueue() : queue(0, 100) {}
+
+    virtual void SetUp() {
+        int values[] = { 10, 85, 15, 70, 20, 60, 30, 50, 65, 80, 90, 40, 5, 55 };
+
+        for(int i = 0; i < 14; ++i)
+            queue.Insert(values[i]);
+    }
+
+    BucketPriorityQueue queue;
+};
+
+TEST(EmptyBucketQueue, Operations)
+{
+    BucketPriorityQueue queue(-1000, 1000);
+
+    EXPECT_TRUE(queue.GetHead() == NULL);
+    EXPECT_FALSE(queue.Remove(0));
+    EXPECT_FALSE(queue.Remove(5000));
+    EXPECT_TRUE(queue.Find(0) == NULL);
+    EXPECT_EQ(queue.Length(), 0);
+    EXPECT_THROW(queue.Insert(1001), std::out_of_range);
+    EXPECT_THROW(BucketPriorityQueue(1, 0), std::invalid_argument);
+    EXPECT_THROW(BucketPriorityQueue(0, static_cast<int>(BucketPriorityQueue::MAX_RANGE)), std::invalid_argument);
+    EXPECT_THROW(BucketPriorityQueue(-2147483647 - 1, 2147483647), std::invalid_argument);
+
+    queue.Insert(-1000);
+    queue.Insert(1000);
+    ASSERT_TRUE(queue.GetHead() != NULL);
+    EXPECT_EQ(queue.GetHead()->value, 1000);
+    EXPECT_EQ(queue.GetHead()->pNext->value, -1000);
+    EXPECT_EQ(queue.Length(), 2);
+}
+
+TEST_F(NonEmptyBucketQueue, Traversal)
+{
+    queue.Insert(55);
+    queue.Insert(100);
+    queue.Insert(0);
+
+    int values[] = { 100, 90, 85, 80, 70, 65, 60, 55, 55, 50, 40, 30, 20, 15, 10, 5, 0 };
+    BucketPriorityQueue::Element_t *pElem = queue.GetHead();
+    for(int i = 0; i < 17; ++i)
+    {
+        ASSERT_TRUE(pElem != NULL);
+        EXPECT_EQ(pElem->value, values[i]);
+        pElem = pElem->pNext;
+    }
+    EXPECT_TRUE(pElem == NULL);
+    EXPECT_EQ(queue.Length(), 17);
+}
+
+TEST_F(NonEmptyBucketQueue, FindAndRemove)
+{
+    int values[] = { 5, 10, 15, 20, 30, 40, 50, 55, 60, 65, 70, 80, 85, 90 };
+    for(int i = 0; i < 14; ++i)
+    {
+        BucketPriorityQueue::Element_t *pElem = queue.Find(values[i]);
+        ASSERT_TRUE(pElem != NULL);
+        EXPECT_EQ(pElem->value, values[i]);
+    }
+    EXPECT_TRUE(queue.Find(0) == NULL);
+
+    EXPECT_FALSE(queue.Remove(0));
+    for(int i = 0; i < 13; ++i)
+    {
+        EXPECT_TRUE(queue.Remove(values[i]));
+        EXPECT_EQ(queue.GetHead()->value, 90);
+        EXPECT_EQ(queue.Length(), 13 - i);
+    }
+    EXPECT_TRUE(queue.Remove(90));
+    EXPECT_TRUE(queue.GetHead() == NULL);
+}
+
+TEST(BucketQueue, PopTopWideRange)
+{
+    // Siroky rozsah, vrchol se odebira i vklada bez prohledavani rozsahu
+    BucketPriorityQueue queue(0, 1 << 22);
+    std::multiset<int> model;
+
+    unsigned seed = 9;
+    for(int i = 0; i < 4000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        int value = static_cast<int>((seed >> 8) % (1 << 22));
+        queue.Insert(value);
+        model.insert(value);
+    }
+
+    // Nove maximum a duplicita vrcholu
+    queue.Insert(1 << 22);
+    queue.Insert(1 << 22);
+    model.insert(1 << 22);
+    model.insert(1 << 22);
+
+    int value;
+    size_t popped = 0;
+    for(std::multiset<int>::reverse_iterator it = model.rbegin(); it != model.rend(); ++it)
+    {
+        ASSERT_EQ(queue.GetHead()->value, *it);
+        ASSERT_TRUE(queue.PopTop(value));
+        ASSERT_EQ(value, *it);
+
+        // Vlozeni noveho maxima do castecne vyprazdnene fronty
+        if(++popped % 1000 == 0)
+        {
+            queue.Insert(value);
+            ASSERT_EQ(queue.GetHead()->value, value);
+            ASSERT_TRUE(queue.PopTop());
+        }
+    }
+    EXPECT_FALSE(queue.PopTop(value));
+    EXPECT_TRUE(queue.GetHead() == NULL);
+    EXPECT_EQ(queue.Length(), 0);
+
+    queue.Insert(5);
+    queue.Insert(1 << 21);
+    ASSERT_TRUE(queue.PopTop(value));
+    EXPECT_EQ(value, 1 << 21);
+    EXPECT_EQ(queue.GetHead()->value, 5);
+}
+
+TEST(MinMaxHeap, Operations)
+{
+    MinMaxHeap heap;
+    int value;
+
+    EXPECT_TRUE(heap.PeekMin() == NULL);
+    EXPECT_TRUE(heap.PeekMax() == NULL);
+    EXPECT_FALSE(heap.PopMin());
+    EXPECT_FALSE(heap.PopMax(value));
+
+    int values[] = { 10, 85, 15, 70, 20, 60, 30, 50, 65, 80, 90, 40, 5, 55 };
+    for(int i = 0; i < 14; ++i)
+        heap.Insert(values[i]);
+    EXPECT_EQ(heap.Length(), 14);
+    EXPECT_EQ(*heap.PeekMin(), 5);
+    EXPECT_EQ(*heap.PeekMax(), 90);
+
+    // Odebirani z obou koncu
+    ASSERT_TRUE(heap.PopMax(value));
+    EXPECT_EQ(value, 90);
+    ASSERT_TRUE(heap.PopMin(value));
+    EXPECT_EQ(value, 5);
+    EXPECT_EQ(*heap.PeekMin(), 10);
+    EXPECT_EQ(*heap.PeekMax(), 85);
+
+    EXPECT_TRUE(heap.Find(50));
+    EXPECT_TRUE(heap.Remove(50));
+    EXPECT_FALSE(heap.Find(50));
+    EXPECT_FALSE(heap.Remove(50));
+    EXPECT_EQ(heap.Length(), 11);
+
+    // Jedina polozka je zaroven nejmensi i nejvetsi
+    MinMaxHeap single(1);
+    single.Insert(7);
+    EXPECT_EQ(*single.PeekMin(), 7);
+    EXPECT_EQ(*single.PeekMax(), 7);
+    EXPECT_TRUE(single.PopMax());
+    EXPECT_TRUE(single.PeekMin() == NULL);
+}
+
+TEST(MinMaxHeap, PopBothEnds)
+{
+    MinMaxHeap heap;
+    std::multiset<int> expected;
+
+    unsigned seed = 11;
+    for(int i = 0; i < 1000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        heap.Insert((seed >> 8) % 500);
+        expected.insert((seed >> 8) % 500);
+    }
+
+    // Odebirani z nahodne zvoleneho konce az do vyprazdneni
+    int actual;
+    while(!expected.empty())
+    {
+        ASSERT_EQ(*heap.PeekMin(), *expected.begin());
+        ASSERT_EQ(*heap.PeekMax(), *expected.rbegin());
+
+        seed = seed * 1103515245 + 12345;
+        if((seed >> 20) % 2 == 0)
+        {
+            ASSERT_TRUE(heap.PopMin(actual));
+            EXPECT_EQ(actual, *expected.begin());
+            expected.erase(expected.begin());
+        }
+        else
+        {
+            ASSERT_TRUE(heap.PopMax(actual));
+            EXPECT_EQ(actual, *expected.rbegin());
+            expected.erase(--expected.end());
+        }
+        ASSERT_EQ(heap.Length(), expected.size());
+    }
+    EXPECT_FALSE(heap.PopMin(actual));
+    EXPECT_FALSE(heap.PopMax(actual));
+}
+
+TEST(UnrolledQueue, Operations)
+{
+    UnrolledPriorityQueue queue;
+
+    EXPECT_TRUE(queue.GetHead() == NULL);
+    EXPECT_FALSE(queue.Remove(0));
+    EXPECT_FALSE(queue.Find(0));
+    EXPECT_EQ(queue.Length(), 0);
+
+    int values[] = { 10, 85, 15, 70, 20, 60, 30, 50, 65, 80, 90, 40, 5, 55 };
+    for(int i = 0; i < 14; ++i)
+        queue.Insert(values[i]);
+    EXPECT_EQ(queue.Length(), 14);
+    ASSERT_TRUE(queue.GetHead() != NULL);
+    EXPECT_EQ(queue.GetHead()->values[0], 90);
+
+    EXPECT_TRUE(queue.Find(50));
+    EXPECT_TRUE(queue.Remove(50));
+    EXPECT_FALSE(queue.Find(50));
+    EXPECT_FALSE(queue.Remove(50));
+
+    for(int i = 0; i < 14; ++i)
+        queue.Remove(values[i]);
+    EXPECT_TRUE(queue.GetHead() == NULL);
+    EXPECT_EQ(queue.Length(), 0);
+}
+
+TEST(SnapshotQueue, Isolation)
+{
+    SnapshotPriorityQueue queue;
+    EXPECT_EQ(queue.Length(), 0);
+    EXPECT_FALSE(queue.Remove(0));
+    EXPECT_FALSE(queue.GetSnapshot().Begin().Valid());
+
+    int values[] = { 10, 85, 15, 70, 20, 60, 30, 50, 65, 80, 90, 40, 5, 55, 50 };
+    for(int i = 0; i < 15; ++i)
+        queue.Insert(values[i]);
+    SnapshotPriorityQueue::Snapshot snapshot = queue.GetSnapshot();
+
+    // Zmeny fronty se ve snimku neprojevi
+    EXPECT_TRUE(queue.Remove(50));
+    EXPECT_TRUE(queue.Remove(90));
+    queue.Insert(100);
+    EXPECT_EQ(queue.Length(), 14);
+    EXPECT_TRUE(queue.Find(50));
+    EXPECT_FALSE(queue.Find(90));
+
+    EXPECT_EQ(snapshot.Length(), 15);
+    EXPECT_TRUE(snapshot.Find(90));
+    EXPECT_FALSE(snapshot.Find(100));
+
+    int expected[] = { 90, 85, 80, 70, 65, 60, 55, 50, 50, 40, 30, 20, 15, 10, 5 };
+    SnapshotPriorityQueue::Snapshot::Iterator it = snapshot.Begin();
+    for(int i = 0; i < 15; ++i)
+    {
+        ASSERT_TRUE(it.Valid());
+        EXPECT_EQ(it.Value(), expected[i]);
+        it.Next();
+    }
+    EXPECT_FALSE(it.Valid());
+}
+
+TEST(SnapshotQueue, ConcurrentReaders)
+{
+    SnapshotPriorityQueue queue;
+    for(int i = 0; i < 1000; ++i)
+        queue.Insert(i);
+
+    // Ctenari prochazeji snimky, zatimco zapisovatel frontu meni
+    std::atomic<bool> done(false);
+    std::vector<std::thread> readers;
+    std::vector<int> errors(2, 0);
+    for(int t = 0; t < 2; ++t)
+    {
+        readers.push_back(std::thread([&queue, &done, &errors, t]() {
+            do
+            {
+                SnapshotPriorityQueue::Snapshot snapshot = queue.GetSnapshot();
+                size_t count = 0;
+                int last = 0;
+                for(SnapshotPriorityQueue::Snapshot::Iterator it = snapshot.Begin();
+                    it.Valid(); it.Next(), ++count)
+                {
+                    if(count > 0 && it.Value() > last)
+                        errors[t]++;
+                    last = it.Value();
+                }
+                if(count != snapshot.Length())
+                    errors[t]++;
+            } while(!done.load());
+        }));
+    }
+
+    for(int i = 0; i < 5000; ++i)
+    {
+        queue.Insert(i % 3000);
+        EXPECT_TRUE(queue.Remove(i % 3000));
+        queue.Insert(i % 1000);
+    }
+    done.store(true);
+    for(size_t t = 0; t < readers.size(); ++t)
+        readers[t].join();
+
+    EXPECT_EQ(errors[0] + errors[1], 0);
+    EXPECT_EQ(queue.Length(), 6000);
+}
+
+TEST(RunLengthQueue, Operations)
+{
+    RunLengthPriorityQueue queue;
+
+    EXPECT_TRUE(queue.GetHead() == NULL);
+    EXPECT_FALSE(queue.Remove(1));
+    EXPECT_TRUE(queue.Find(1) == NULL);
+
+    // Tri ruzne hodnoty s mnoha opakovanimi
+    for(int i = 0; i < 3000; ++i)
+        queue.Insert(i % 3);
+    EXPECT_EQ(queue.Length(), 3000);
+
+    RunLengthPriorityQueue::Element_t *pElem = queue.GetHead();
+    for(int value = 2; value >= 0; --value)
+    {
+        ASSERT_TRUE(pElem != NULL);
+        EXPECT_EQ(pElem->value, value);
+        EXPECT_EQ(pElem->count, 1000);
+        pElem = pElem->pNext;
+    }
+    EXPECT_TRUE(pElem == NULL);
+
+    // Odstraneni snizuje pocet, polozka zmizi s poslednim vyskytem
+    pElem = queue.Find(1);
+    ASSERT_TRUE(pElem != NULL);
+    for(int i = 0; i < 999; ++i)
+        EXPECT_TRUE(queue.Remove(1));
+    EXPECT_EQ(queue.Find(1), pElem);
+    EXPECT_EQ(pElem->count, 1);
+    EXPECT_TRUE(queue.Remove(1));
+    EXPECT_TRUE(queue.Find(1) == NULL);
+    EXPECT_FALSE(queue.Remove(1));
+    EXPECT_EQ(queue.Length(), 2000);
+    EXPECT_EQ(queue.GetHead()->pNext->value, 0);
+}
+
+TEST(BlockingQueue, TimeoutAndBatch)
+{
+    BlockingPriorityQueue<int> queue;
+    int value = -1;
+
+    // Prazdna fronta: cekani vyprsi
+    EXPECT_FALSE(queue.TryPop(value));
+    EXPECT_FALSE(queue.WaitPop(value, std::chrono::milliseconds(10)));
+    std::vector<int> out;
+    EXPECT_EQ(queue.PopUpTo(5, out, std::chrono::milliseconds(10)), 0);
+
+    // Davka nulove velikosti se vrati bez cekani
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    EXPECT_EQ(queue.PopUpTo(0, out), 0);
+    EXPECT_EQ(queue.PopUpTo(0, out, std::chrono::seconds(10)), 0);
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::seconds(5));
+
+    int values[] = { 10, 85, 15, 70, 20, 60, 30 };
+    for(int i = 0; i < 7; ++i)
+        EXPECT_TRUE(queue.Push(values[i]));
+    EXPECT_EQ(queue.Length(), 7);
+
+    // Davka je serazena podle priority
+    EXPECT_EQ(queue.PopUpTo(3, out), 3);
+    ASSERT_EQ(out.size(), 3);
+    EXPECT_EQ(out[0], 85);
+    EXPECT_EQ(out[1], 70);
+    EXPECT_EQ(out[2], 60);
+    EXPECT_TRUE(queue.WaitPop(value, std::chrono::milliseconds(10)));
+    EXPECT_EQ(value, 30);
+
+    // Po uzavreni se zbyvajici polozky stale vydavaji
+    queue.Close();
+    EXPECT_TRUE(queue.IsClosed());
+    EXPECT_FALSE(queue.Push(100));
+    EXPECT_EQ(queue.PopUpTo(10, out), 3);
+    EXPECT_EQ(out.back(), 10);
+    EXPECT_FALSE(queue.WaitPop(value));
+    EXPECT_EQ(queue.PopUpTo(10, out), 0);
+}
+
+TEST(BlockingQueue, ProducersAndConsumers)
+{
+    const int PRODUCERS = 2;
+    const int CONSUMERS = 3;
+    const int ITEMS = 5000;
+    BlockingPriorityQueue<int> queue;
+
+    // Konzumenti cekaji drive, nez producenti zacnou vkladat
+    std::vector<std::vector<int> > received(CONSUMERS);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < CONSUMERS; ++t)
+    {
+        threads.push_back(std::thread([&queue, &received, t]() {
+            if((t % 2) == 0)
+            {
+                while(queue.PopUpTo(16, received[t]) > 0)
+                    ;   // zamerne prazdne telo
+            }
+            else
+            {
+                int value;
+                while(queue.WaitPop(value))
+                    received[t].push_back(value);
+            }
+        }));
+    }
+
+    std::vector<std::thread> producers;
+    for(int t = 0; t < PRODUCERS; ++t)
+    {
+        producers.push_back(std::thread([&queue, t]() {
+            for(int i = t; i < ITEMS; i += PRODUCERS)
+                queue.Push(i);
+        }));
+    }
+    for(int t = 0; t < PRODUCERS; ++t)
+        producers[t].join();
+    queue.Close();
+    for(int t = 0; t < CONSUMERS; ++t)
+        threads[t].join();
+
+    // Kazda polozka byla odebrana prave jednou
+    std::vector<int> all;
+    for(int t = 0; t < CONSUMERS; ++t)
+        all.insert(all.end(), received[t].begin(), received[t].end());
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), ITEMS);
+    for(int i = 0; i < ITEMS; ++i)
+        EXPECT_EQ(all[i], i);
+    EXPECT_EQ(queue.Length(), 0);
+}
+
+TEST(TimerWheel, ScheduleAndCancel)
+{
+    TimerWheel wheel(100);
+    std::vector<int> fired;
+
+    EXPECT_EQ(wheel.Advance(50, fired), 0);
+    EXPECT_EQ(wheel.Now(), 100);
+
+    wheel.Schedule(300, 3);
+    TimerWheel::Handle_t cancelled = wheel.Schedule(200, 2);
+    wheel.Schedule(150, 1);
+    wheel.Schedule(70000, 5);
+    TimerWheel::Handle_t far = wheel.Schedule(static_cast<uint64_t>(1) << 40, 7);
+    wheel.Schedule(static_cast<uint64_t>(1) << 41, 8);
+    EXPECT_EQ(wheel.Length(), 6);
+
+    wheel.Cancel(cancelled);
+    wheel.Cancel(far);
+    EXPECT_EQ(wheel.Length(), 4);
+
+    // Vyprsi vse do casu 300 vcetne, v poradi casu vyprseni
+    EXPECT_EQ(wheel.Advance(300, fired), 2);
+    ASSERT_EQ(fired.size(), 2);
+    EXPECT_EQ(fired[0], 1);
+    EXPECT_EQ(fired[1], 3);
+
+    // Casovac v minulosti vyprsi pri pristim Advance
+    wheel.Schedule(10, 0);
+    EXPECT_EQ(wheel.Advance(300, fired), 1);
+    EXPECT_EQ(fired.back(), 0);
+
+    EXPECT_EQ(wheel.Advance(static_cast<uint64_t>(1) << 42, fired), 2);
+    EXPECT_EQ(fired[fired.size() - 2], 5);
+    EXPECT_EQ(fired.back(), 8);
+    EXPECT_EQ(wheel.Length(), 0);
+}
+
+TEST(TimerWheel, MatchesSortedModel)
+{
+    TimerWheel wheel;
+    std::multimap<uint64_t, TimerWheel::Handle_t> model;
+    std::map<TimerWheel::Handle_t, int> values;
+
+    unsigned seed = 19;
+    uint64_t now = 0;
+    std::vector<int> fired;
+    std::vector<uint64_t> deadlines;
+    for(int i = 0; i < 20000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        unsigned operation = (seed >> 16) % 8;
+        seed = seed * 1103515245 + 12345;
+        uint64_t delay = (seed >> 4) >> (seed % 28);
+        if(operation < 5)
+        {
+            // Ruzne vzdalene casy, obcas mimo rozsah kola
+            if(operation == 4)
+                delay <<= 20;
+            TimerWheel::Handle_t handle = wheel.Schedule(now + delay, static_cast<int>(deadlines.size()));
+            model.insert(std::make_pair(now + delay, handle));
+            values[handle] = static_cast<int>(deadlines.size());
+            deadlines.push_back(now + delay);
+        }
+        else if(operation == 5 && !model.empty())
+        {
+            std::multimap<uint64_t, TimerWheel::Handle_t>::iterator it = model.begin();
+            std::advance(it, (seed >> 8) % model.size());
+            wheel.Cancel(it->second);
+            values.erase(it->second);
+            model.erase(it);
+        }
+        else
+        {
+            now += delay >> 4;
+            fired.clear();
+            size_t count = wheel.Advance(now, fired);
+            std::vector<int> expected;
+            while(!model.empty() && model.begin()->first <= now)
+            {
+                expected.push_back(values[model.begin()->second]);
+                values.erase(model.begin()->second);
+                model.erase(model.begin());
+            }
+            ASSERT_EQ(count, expected.size());
+            for(size_t j = 1; j < fired.size(); ++j)
+                EXPECT_LE(deadlines[fired[j - 1]], deadlines[fired[j]]);
+
+            // Casovace se stejnym casem mohou vyprset v libovolnem poradi
+            std::sort(fired.begin(), fired.end());
+            std::sort(expected.begin(), expected.end());
+            EXPECT_EQ(fired, expected);
+        }
+        ASSERT_EQ(wheel.Length(), model.size());
+    }
+}
+
+TEST(BoundedQueue, RejectsAndEvicts)
+{
+    BoundedPriorityQueue<int> queue(3);
+    EXPECT_TRUE(queue.GetWorst() == NULL);
+    EXPECT_EQ(queue.Capacity(), 3);
+
+    EXPECT_TRUE(queue.Insert(10));
+    EXPECT_TRUE(queue.Insert(5));
+    EXPECT_TRUE(queue.Insert(20));
+    EXPECT_EQ(queue.Length(), 3);
+    EXPECT_EQ(*queue.GetWorst(), 5);
+
+    // Polozka, ktera neni lepsi nez nejhorsi uchovana, se odmitne
+    EXPECT_FALSE(queue.Insert(5));
+    EXPECT_FALSE(queue.Insert(1));
+    EXPECT_EQ(*queue.GetWorst(), 5);
+
+    // Lepsi polozka vytlaci nejhorsi
+    EXPECT_TRUE(queue.Insert(15));
+    EXPECT_EQ(*queue.GetWorst(), 10);
+    EXPECT_EQ(queue.Length(), 3);
+
+    std::vector<int> result(1, -1);
+    queue.ExtractSorted(result);
+    int values[] = { -1, 20, 15, 10 };
+    EXPECT_EQ(result, std::vector<int>(values, values + 4));
+    EXPECT_EQ(queue.Length(), 0);
+
+    BoundedPriorityQueue<int> none(0);
+    EXPECT_FALSE(none.Insert(1));
+    EXPECT_EQ(none.Length(), 0);
+}
+
+TEST(BoundedQueue, MatchesSortedStream)
+{
+    // Nejmensich K hodnot pomoci obraceneho porovnani
+    BoundedPriorityQueue<int, std::greater<int> > lowest(100);
+    BoundedPriorityQueue<Task_t, TaskCompare> highest(50);
+    std::vector<int> stream;
+
+    unsigned seed = 20;
+    for(int i = 0; i < 20000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        int value = static_cast<int>((seed >> 8) % 5000);
+        stream.push_back(value);
+        lowest.Insert(value);
+        highest.Insert(Task_t(value, "task"));
+        ASSERT_LE(lowest.Length(), 100);
+    }
+
+    std::sort(stream.begin(), stream.end());
+    std::vector<int> result;
+    lowest.ExtractSorted(result);
+    EXPECT_EQ(result, std::vector<int>(stream.begin(), stream.begin() + 100));
+
+    std::vector<Task_t> tasks;
+    highest.ExtractSorted(tasks);
+    ASSERT_EQ(tasks.size(), 50);
+    for(size_t i = 0; i < tasks.size(); ++i)
+    {
+        EXPECT_EQ(tasks[i].priority, stream[stream.size() - 1 - i]);
+        EXPECT_EQ(*tasks[i].name, "task");
+    }
+}
+
+TEST(IndexedQueue, Operations)
+{
+    IndexedPriorityQueue queue;
+    EXPECT_TRUE(queue.GetHead() == NULL);
+    EXPECT_FALSE(queue.Remove(0));
+    EXPECT_TRUE(queue.Find(0) == NULL);
+
+    int inserted[] = { 50, 10, 30, 30, 90, 10, 30 };
+    for(int i = 0; i < 7; ++i)
+        queue.Insert(inserted[i]);
+    EXPECT_EQ(queue.Length(), 7);
+
+    int values[] = { 90, 50, 30, 30, 30, 10, 10 };
+    IndexedPriorityQueue::Element_t *pElem = queue.GetHead();
+    for(int i = 0; i < 7; ++i)
+    {
+        ASSERT_TRUE(pElem != NULL);
+        EXPECT_EQ(pElem->value, values[i]);
+        pElem = pElem->pNext;
+    }
+    EXPECT_TRUE(pElem == NULL);
+
+    ASSERT_TRUE(queue.Find(30) != NULL);
+    EXPECT_EQ(queue.Find(30)->value, 30);
+    EXPECT_EQ(queue.Find(50)->pNext, queue.Find(30));
+
+    // Odstraneni celeho useku napojuje sousedni useky
+    EXPECT_TRUE(queue.Remove(50));
+    EXPECT_EQ(queue.GetHead()->pNext, queue.Find(30));
+    EXPECT_TRUE(queue.Remove(90));
+    EXPECT_EQ(queue.GetHead(), queue.Find(30));
+    EXPECT_TRUE(queue.Remove(30));
+    EXPECT_TRUE(queue.Remove(30));
+    EXPECT_TRUE(queue.Remove(30));
+    EXPECT_FALSE(queue.Remove(30));
+    EXPECT_EQ(queue.GetHead(), queue.Find(10));
+    EXPECT_EQ(queue.Length(), 2);
+}
+
+TEST(ExternalQueue, InvalidBudget)
+{
+    EXPECT_THROW(ExternalPriorityQueue(1024, 256), std::invalid_argument);
+    EXPECT_THROW(ExternalPriorityQueue(1 << 20, 2), std::invalid_argument);
+
+    ExternalPriorityQueue queue(2048, 256);
+    int value;
+    EXPECT_TRUE(queue.GetTop() == NULL);
+    EXPECT_FALSE(queue.PopTop(value));
+    EXPECT_EQ(queue.Length(), 0);
+    EXPECT_EQ(queue.RunCount(), 0);
+}
+
+TEST(ExternalQueue, SpillsAndMerges)
+{
+    // Halda pojme 960 hodnot, blok 64 hodnot, nejvyse 14 behu
+    ExternalPriorityQueue queue(8192, 256);
+    std::multiset<int> model;
+
+    unsigned seed = 22;
+    for(int i = 0; i < 60000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        if((seed >> 16) % 5 == 0 && !model.empty())
+        {
+            int value;
+            ASSERT_TRUE(queue.PopTop(value));
+            ASSERT_EQ(value, *model.rbegin());
+            model.erase(--model.end());
+        }
+        else
+        {
+            int value = static_cast<int>(seed >> 4) - (1 << 27);
+            ASSERT_TRUE(queue.Insert(value));
+            model.insert(value);
+        }
+        ASSERT_EQ(queue.Length(), model.size());
+        ASSERT_LE(queue.RunCount(), 14);
+    }
+    EXPECT_GT(queue.RunCount(), 1);
+
+    ASSERT_TRUE(queue.GetTop() != NULL);
+    EXPECT_EQ(*queue.GetTop(), *model.rbegin());
+
+    int value;
+    for(std::multiset<int>::reverse_iterator it = model.rbegin(); it != model.rend(); ++it)
+    {
+        ASSERT_TRUE(queue.PopTop(value));
+        ASSERT_EQ(value, *it);
+    }
+    EXPECT_FALSE(queue.PopTop(value));
+    EXPECT_EQ(queue.RunCount(), 0);
+}
+
+TEST(BitmapQueue, Operations)
+{
+    BitmapPriorityQueue queue;
+    int value;
+    EXPECT_FALSE(queue.GetTop(value));
+    EXPECT_FALSE(queue.PopTop(value));
+    EXPECT_FALSE(queue.Remove(0));
+    EXPECT_FALSE(queue.Successor(0, value));
+
+    int inserted[] = { 0, -1, 2147483647, -2147483647 - 1, 64, 64, 4096 };
+    for(int i = 0; i < 7; ++i)
+        queue.Insert(inserted[i]);
+    EXPECT_EQ(queue.Length(), 7);
+    EXPECT_EQ(queue.Count(64), 2);
+    EXPECT_TRUE(queue.Find(-1));
+    EXPECT_FALSE(queue.Find(1));
+
+    // Pruchod od vrcholu pres predchudce
+    int values[] = { 2147483647, 4096, 64, 0, -1, -2147483647 - 1 };
+    ASSERT_TRUE(queue.GetTop(value));
+    for(int i = 0; i < 6; ++i)
+    {
+        EXPECT_EQ(value, values[i]);
+        EXPECT_EQ(queue.Predecessor(value, value), i < 5);
+    }
+    ASSERT_TRUE(queue.Successor(-2147483647 - 1, value));
+    EXPECT_EQ(value, -1);
+    ASSERT_TRUE(queue.Successor(65, value));
+    EXPECT_EQ(value, 4096);
+    EXPECT_FALSE(queue.Successor(2147483647, value));
+
+    EXPECT_TRUE(queue.Remove(64));
+    EXPECT_TRUE(queue.Find(64));
+    EXPECT_TRUE(queue.Remove(64));
+    EXPECT_FALSE(queue.Find(64));
+    ASSERT_TRUE(queue.Predecessor(4096, value));
+    EXPECT_EQ(value, 0);
+    EXPECT_EQ(queue.Length(), 5);
+}
+
+TEST(BitmapQueue, NeighborsOverFullRange)
+{
+    BitmapPriorityQueue queue;
+    std::multiset<int> model;
+
+    // Shluky blizkych hodnot i hodnoty z celeho rozsahu
+    unsigned seed = 23;
+    for(int i = 0; i < 5000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        int value = (seed & 1) != 0 ? static_cast<int>(seed) : static_cast<int>(seed >> 20) - 2048;
+        queue.Insert(value);
+        model.insert(value);
+    }
+
+    // Sousede nahodnych hodnot, ve fronte obsazenych i chybejicich
+    for(int i = 0; i < 5000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        int value = (seed & 1) != 0 ? static_cast<int>(seed) : static_cast<int>(seed >> 20) - 2048;
+        int result;
+
+        std::multiset<int>::iterator upper = model.upper_bound(value);
+        ASSERT_EQ(queue.Successor(value, result), upper != model.end());
+        if(upper != model.end())
+        {
+            ASSERT_EQ(result, *upper);
+        }
+
+        std::multiset<int>::iterator lower = model.lower_bound(value);
+        ASSERT_EQ(queue.Predecessor(value, result), lower != model.begin());
+        if(lower != model.begin())
+        {
+            ASSERT_EQ(result, *--lower);
+        }
+    }
+
+    // Odebirani vrcholu az do vyprazdneni
+    int top;
+    while(!model.empty())
+    {
+        ASSERT_TRUE(queue.PopTop(top));
+        ASSERT_EQ(top, *model.rbegin());
+        model.erase(--model.end());
+    }
+    EXPECT_FALSE(queue.PopTop(top));
+    EXPECT_EQ(queue.Length(), 0);
+}
+
+// Hodnoty v porovnani s modelem jsou z intervalu <-MODEL_RANGE, MODEL_RANGE)
+const int MODEL_RANGE = 1000;
+
+/**
+ * @brief The QueueTraits struct
+ * Prizpusobeni fronty spolecnemu porovnani s modelem (std::multiset). Obecna
+ * sablona pokryva fronty se seznamem polozek (GetHead(), pNext), ostatni
+ * fronty ji specializuji.
+ */
+template <typename Queue>
+struct QueueTraits
+{
+    static Queue *Create()
+    {
+        return new Queue();
+    }
+
+    // Hodnoty fronty od nejvyssi po nejnizsi
+    static void Contents(Queue &queue, std::vector<int> &values)
+    {
+        for(typename Queue::Element_t *pElem = queue.GetHead(); pElem != NULL; pElem = pElem->pNext)
+            values.push_back(pElem->value);
+    }
+};
+
+template <>
+BucketPriorityQueue *QueueTraits<BucketPriorityQueue>::Create()
+{
+    return new BucketPriorityQueue(-MODEL_RANGE, MODEL_RANGE - 1);
+}
+
+template <>
+void QueueTraits<MinMaxHeap>::Contents(MinMaxHeap &queue, std::vector<int> &values)
+{
+    MinMaxHeap copy(queue);
+    int value;
+    while(copy.PopMax(value))
+        values.push_back(value);
+}
+
+// Bloky nesmi byt prazdne ani preplnene
+template <>
+void QueueTraits<UnrolledPriorityQueue>::Contents(UnrolledPriorityQueue &queue, std::vector<int> &values)
+{
+    for(const UnrolledPriorityQueue::Block_t *pBlock = queue.GetHead(); pBlock != NULL; pBlock = pBlock->pNext)
+    {
+        ASSERT_GT(pBlock->count, 0u);
+        ASSERT_LE(pBlock->count, UnrolledPriorityQueue::CAPACITY);
+        values.insert(values.end(), pBlock->values, pBlock->values + pBlock->count);
+    }
+}
+
+// Kazda hodnota ma jedinou polozku s nenulovym poctem vyskytu
+template <>
+void QueueTraits<RunLengthPriorityQueue>::Contents(RunLengthPriorityQueue &queue, std::vector<int> &values)
+{
+    for(RunLengthPriorityQueue::Element_t *pElem = queue.GetHead(); pElem != NULL; pElem = pElem->pNext)
+    {
+        ASSERT_GT(pElem->count, 0u);
+        if(pElem->pNext != NULL)
+        {
+            ASSERT_GT(pElem->value, pElem->pNext->value);
+        }
+        values.insert(values.end(), pElem->count, pElem->value);
+    }
+}
+
+// Pruchod od vrcholu pres predchudce, kazda hodnota Count-krat
+template <>
+void QueueTraits<BitmapPriorityQueue>::Contents(BitmapPriorityQueue &queue, std::vector<int> &values)
+{
+    int value;
+    for(bool found = queue.GetTop(value); found; found = queue.Predecessor(value, value))
+        values.insert(values.end(), queue.Count(value), value);
+}
+
+// Find vraci podle fronty bud priznak, nebo ukazatel na polozku
+inline bool Found(bool found)
+{
+    return found;
+}
+
+template <typename T>
+inline bool Found(const T *pElem)
+{
+    return pElem != NULL;
+}
+
+template <typename Queue>
+class MatchesModel : public ::testing::Test
+{
+protected:
+    // Porovna cely obsah fronty s modelem
+    void ExpectContents()
+    {
+        std::vector<int> values;
+        QueueTraits<Queue>::Contents(*queue, values);
+        std::vector<int> expected(model.rbegin(), model.rend());
+        EXPECT_TRUE(values == expected);
+    }
+
+    std::unique_ptr<Queue> queue;
+    std::multiset<int> model;
+};
+
+typedef ::testing::Types<PriorityQueue, BucketPriorityQueue, MinMaxHeap,
+                         UnrolledPriorityQueue, RunLengthPriorityQueue,
+                         IndexedPriorityQueue, BitmapPriorityQueue> ModelQueueTypes;
+TYPED_TEST_SUITE(MatchesModel, ModelQueueTypes);
+
+TYPED_TEST(MatchesModel, RandomInsertAndRemove)
+{
+    this->queue.reset(QueueTraits<TypeParam>::Create());
+
+    unsigned seed = 7;
+    for(int i = 0; i < 5000; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        // Strida se maly rozsah hodnot (mnoho stejnych) a cely rozsah modelu
+        int value = ((seed >> 24) & 1) != 0 ? static_cast<int>((seed >> 8) % 16) - 8
+                                            : static_cast<int>((seed >> 8) % (2 * MODEL_RANGE)) - MODEL_RANGE;
+        if((seed >> 20) % 3 == 0)
+        {
+            std::multiset<int>::iterator it = this->model.find(value);
+            ASSERT_EQ(this->queue->Remove(value), it != this->model.end());
+            if(it != this->model.end())
+                this->model.erase(it);
+        }
+        else
+        {
+            this->queue->Insert(value);
+            this->model.insert(value);
+        }
+        ASSERT_EQ(Found(this->queue->Find(value)), this->model.count(value) > 0);
+        ASSERT_EQ(this->queue->Length(), this->model.size());
+
+        if(i % 500 == 0)
+            this->ExpectContents();
+    }
+    this->ExpectContents();
+
+    // Vyprazdneni fronty
+    std::vector<int> values;
+    QueueTraits<TypeParam>::Contents(*this->queue, values);
+    for(size_t i = 0; i < values.size(); ++i)
+        ASSERT_TRUE(this->queue->Remove(values[i]));
+    EXPECT_EQ(this->queue->Length(), 0);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(MappedQueue, Reopen)
+{
+    std::string path = ::testing::TempDir() + "mapped_queue_reopen.bin";
+    remove(path.c_str());
+
+    MappedPriorityQueue queue;
+    EXPECT_FALSE(queue.IsOpen());
+    EXPECT_FALSE(queue.Insert(1));
+    EXPECT_TRUE(queue.GetTop() == NULL);
+
+    // Maly soubor se pri vkladani zvetsuje
+    ASSERT_TRUE(queue.Open(path.c_str(), 4));
+    int values[] = { 10, 85, 15, 70, 20, 60, 30, 50, 65, 80, 90, 40, 5, 55 };
+    for(int i = 0; i < 14; ++i)
+        ASSERT_TRUE(queue.Insert(values[i]));
+    EXPECT_TRUE(queue.Remove(50));
+    EXPECT_FALSE(queue.Remove(50));
+    queue.Close();
+    EXPECT_EQ(queue.Length(), 0);
+
+    // Po znovuotevreni je obsah stejny, kapacita se jiz neuplatni
+    ASSERT_TRUE(queue.Open(path.c_str(), 1, 1));
+    EXPECT_EQ(queue.Length(), 13);
+    EXPECT_TRUE(queue.Find(5));
+    EXPECT_FALSE(queue.Find(50));
+
+    int expected[] = { 90, 85, 80, 70, 65, 60, 55, 40, 30, 20, 15, 10, 5 };
+    int value;
+    for(int i = 0; i < 13; ++i)
+    {
+        ASSERT_TRUE(queue.PopTop(value));
+        EXPECT_EQ(value, expected[i]);
+    }
+    EXPECT_FALSE(queue.PopTop(value));
+    queue.Close();
+    remove(path.c_str());
+}
+
+TEST(MappedQueue, InvalidAndDamagedFiles)
+{
+    std::string path = ::testing::TempDir() + "mapped_queue_damaged.bin";
+
+    // Soubor, ktery neni souborem fronty, se neotevre
+    FILE *file = fopen(path.c_str(), "wb");
+    ASSERT_TRUE(file != NULL);
+    fputs("neni fronta, jen text dostatecne dlouhy na hlavicku", file);
+    fclose(file);
+    MappedPriorityQueue queue;
+    EXPECT_FALSE(queue.Open(path.c_str()));
+    EXPECT_FALSE(queue.IsOpen());
+    remove(path.c_str());
+
+    ASSERT_TRUE(queue.Open(path.c_str(), 16));
+    for(int i = 0; i < 10; ++i)
+        queue.Insert(i);
+    queue.Close();
+
+    // Prepsani vrcholu haldy (jako by zapis nebyl dokoncen)
+    file = fopen(path.c_str(), "r+b");
+    ASSERT_TRUE(file != NULL);
+    int damaged = -1;
+    fseek(file, 24, SEEK_SET);
+    fwrite(&damaged, sizeof(damaged), 1, file);
+    fclose(file);
+
+    ASSERT_TRUE(queue.Open(path.c_str()));
+    EXPECT_EQ(queue.Length(), 10);
+    EXPECT_EQ(*queue.GetTop(), 8);
+    queue.Close();
+
+    // Poskozena kapacita, jejiz nasobek by pretekl, a pocet nad kapacitou
+    uint64_t capacity = static_cast<uint64_t>(1) << 62;
+    file = fopen(path.c_str(), "r+b");
+    ASSERT_TRUE(file != NULL);
+    fseek(file, 8, SEEK_SET);
+    fwrite(&capacity, sizeof(capacity), 1, file);
+    fclose(file);
+    EXPECT_FALSE(queue.Open(path.c_str()));
+    EXPECT_FALSE(queue.IsOpen());
+
+    uint64_t header[2] = { 16, 17 };
+    file = fopen(path.c_str(), "r+b");
+    ASSERT_TRUE(file != NULL);
+    fseek(file, 8, SEEK_SET);
+    fwrite(header, sizeof(header[0]), 2, file);
+    fclose(file);
+    EXPECT_FALSE(queue.Open(path.c_str()));
+    EXPECT_FALSE(queue.IsOpen());
+    remove(path.c_str());
+}
+#endif
+
 /*** Konec souboru tdd_tests.cpp ***/
@@ -0,0 +1,285 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - hierarchical timing wheel for timers
+//
+// $NoKeywords: $ivs_project_1 $timer_wheel.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file timer_wheel.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod hierarchickeho casovaciho kola.
+ */
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "timer_wheel.h"
+
+const unsigned TimerWheel::SLOT_BITS;
+const unsigned TimerWheel::SLOTS;
+const unsigned TimerWheel::LEVELS;
+const unsigned TimerWheel::LEVEL_OVERFLOW;
+const unsigned TimerWheel::LEVEL_DUE;
+const unsigned TimerWheel::LEVEL_CANCELLED;
+const unsigned TimerWheel::WORDS;
+const uint64_t TimerWheel::NEVER;
+
+namespace {
+
+/**
+ * @brief LowestBit
+ * @return Vraci index nejnizsiho nastaveneho bitu nenuloveho slova "word".
+ */
+inline unsigned LowestBit(uint64_t word)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned index = 0;
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief Digit
+ * @return Vraci index prihradky casu "time" v urovni "level".
+ */
+inline unsigned Digit(uint64_t time, unsigned level)
+{
+    return static_cast<unsigned>(time >> (level * TimerWheel::SLOT_BITS)) & (TimerWheel::SLOTS - 1);
+}
+
+} // namespace
+
+TimerWheel::TimerWheel(uint64_t now)
+    : m_pDue(nullptr), m_now(now), m_length(0)
+{
+    memset(m_apSlots, 0, sizeof(m_apSlots));
+    memset(m_occupied, 0, sizeof(m_occupied));
+}
+
+TimerWheel::Handle_t TimerWheel::Schedule(uint64_t deadline, int value)
+{
+    Timer_t *timer = m_pool.Allocate();
+    timer->deadline = deadline;
+    timer->value = value;
+
+    if (deadline <= m_now)
+    {
+        timer->level = LEVEL_DUE;
+        Link(&m_pDue, timer);
+    }
+    else
+        Place(timer);
+    m_length++;
+    return timer;
+}
+
+void TimerWheel::Cancel(Handle_t handle)
+{
+    m_length--;
+    if (handle->level == LEVEL_OVERFLOW)
+    {
+        // Z haldy nelze odstranit v O(1), casovac se uvolni az pri jejim cteni
+        handle->level = LEVEL_CANCELLED;
+        return;
+    }
+
+    *handle->ppPrev = handle->pNext;
+    if (handle->pNext != nullptr)
+        handle->pNext->ppPrev = handle->ppPrev;
+    if (handle->level < LEVELS && m_apSlots[handle->level][handle->slot] == nullptr)
+        m_occupied[handle->level][handle->slot / 64] &= ~(static_cast<uint64_t>(1) << (handle->slot % 64));
+    m_pool.Release(handle);
+}
+
+size_t TimerWheel::Advance(uint64_t now, std::vector<int> &fired)
+{
+    size_t count = 0;
+
+    // Casovace naplanovane do minulosti, serazene podle casu vyprseni
+    if (m_pDue != nullptr)
+    {
+        std::vector<std::pair<uint64_t, int> > due;
+        for (Timer_t *timer = m_pDue; timer != nullptr; timer = timer->pNext)
+            due.push_back(std::make_pair(timer->deadline, timer->value));
+        std::stable_sort(due.begin(), due.end());
+        for (size_t i = 0; i < due.size(); i++)
+            fired.push_back(due[i].second);
+        count += due.size();
+
+        while (m_pDue != nullptr)
+        {
+            Timer_t *timer = m_pDue;
+            m_pDue = timer->pNext;
+            m_pool.Release(timer);
+        }
+    }
+
+    for (;;)
+    {
+        uint64_t next = NextEvent();
+        if (next == NEVER || next > now)
+            break;
+        m_now = next;
+
+        // Vzdalene casovace, jejichz cas spadl do rozsahu kola
+        const unsigned range = LEVELS * SLOT_BITS;
+        while (m_overflow.Length() > 0 && (m_overflow.GetTop()->deadline >> range) == (m_now >> range))
+        {
+            Timer_t *timer = m_overflow.GetTop()->pTimer;
+            m_overflow.PopTop();
+            if (timer->level == LEVEL_CANCELLED)
+                m_pool.Release(timer);
+            else
+                Place(timer);
+        }
+
+        // Presun prihradek vyssich urovni, ktere prave zacinaji, smerem dolu
+        for (unsigned level = LEVELS - 1; level > 0; level--)
+        {
+            if ((m_now & ((static_cast<uint64_t>(1) << (level * SLOT_BITS)) - 1)) != 0)
+                continue;
+            Timer_t *list = TakeSlot(level, Digit(m_now, level));
+            while (list != nullptr)
+            {
+                Timer_t *timer = list;
+                list = list->pNext;
+                Place(timer);
+            }
+        }
+
+        count += Fire(TakeSlot(0, Digit(m_now, 0)), fired);
+    }
+
+    if (now > m_now)
+        m_now = now;
+    m_length -= count;
+    return count;
+}
+
+uint64_t TimerWheel::Now() const
+{
+    return m_now;
+}
+
+size_t TimerWheel::Length() const
+{
+    return m_length;
+}
+
+void TimerWheel::Place(Timer_t *timer)
+{
+    // Nejnizsi uroven, nad kterou se cas vyprseni shoduje s aktualnim casem
+    unsigned level = 0;
+    while (level < LEVELS && (timer->deadline >> ((level + 1) * SLOT_BITS)) != (m_now >> ((level + 1) * SLOT_BITS)))
+        level++;
+
+    if (level == LEVELS)
+    {
+        timer->level = LEVEL_OVERFLOW;
+        timer->pNext = nullptr;
+        timer->ppPrev = nullptr;
+        Overflow_t entry = { timer->deadline, timer };
+        m_overflow.Insert(entry);
+        return;
+    }
+
+    unsigned slot = Digit(timer->deadline, level);
+    timer->level = level;
+    timer->slot = slot;
+    Link(&m_apSlots[level][slot], timer);
+    m_occupied[level][slot / 64] |= static_cast<uint64_t>(1) << (slot % 64);
+}
+
+void TimerWheel::Link(Timer_t **head, Timer_t *timer)
+{
+    timer->pNext = *head;
+    if (*head != nullptr)
+        (*head)->ppPrev = &timer->pNext;
+    timer->ppPrev = head;
+    *head = timer;
+}
+
+uint64_t TimerWheel::NextEvent()
+{
+    uint64_t next = NEVER;
+
+    // V kazde urovni nejblizsi obsazena prihradka za aktualni prihradkou,
+    // v urovni 0 je to cas vyprseni, ve vyssich cas presunu dolu
+    for (unsigned level = 0; level < LEVELS; level++)
+    {
+        unsigned slot = NextSlot(level, Digit(m_now, level));
+        if (slot == SLOTS)
+            continue;
+
+        unsigned shift = (level + 1) * SLOT_BITS;
+        uint64_t base = shift < 64 ? (m_now >> shift) << shift : 0;
+        uint64_t time = base | (static_cast<uint64_t>(slot) << (level * SLOT_BITS));
+        if (time < next)
+            next = time;
+    }
+
+    // Zrusene casovace na vrcholu haldy se rovnou uvolni
+    while (m_overflow.Length() > 0 && m_overflow.GetTop()->pTimer->level == LEVEL_CANCELLED)
+    {
+        m_pool.Release(m_overflow.GetTop()->pTimer);
+        m_overflow.PopTop();
+    }
+    if (m_overflow.Length() > 0)
+    {
+        const unsigned range = LEVELS * SLOT_BITS;
+        uint64_t time = (m_overflow.GetTop()->deadline >> range) << range;
+        if (time < next)
+            next = time;
+    }
+    return next;
+}
+
+unsigned TimerWheel::NextSlot(unsigned level, unsigned slot) const
+{
+    // Bity za prihradkou "slot" v jejim slove, pote nasledujici slova
+    unsigned word = slot / 64;
+    uint64_t mask = (slot % 64) == 63 ? 0 : m_occupied[level][word] & (~static_cast<uint64_t>(0) << (slot % 64 + 1));
+    while (mask == 0)
+    {
+        if (++word >= WORDS)
+            return SLOTS;
+        mask = m_occupied[level][word];
+    }
+    return word * 64 + LowestBit(mask);
+}
+
+TimerWheel::Timer_t *TimerWheel::TakeSlot(unsigned level, unsigned slot)
+{
+    Timer_t *list = m_apSlots[level][slot];
+    m_apSlots[level][slot] = nullptr;
+    m_occupied[level][slot / 64] &= ~(static_cast<uint64_t>(1) << (slot % 64));
+    return list;
+}
+
+size_t TimerWheel::Fire(Timer_t *list, std::vector<int> &fired)
+{
+    size_t count = 0;
+    while (list != nullptr)
+    {
+        Timer_t *timer = list;
+        list = list->pNext;
+        fired.push_back(timer->value);
+        m_pool.Release(timer);
+        count++;
+    }
+    return count;
+}
+
+/*** Konec souboru timer_wheel.cpp ***/
@@ -0,0 +1,220 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - hierarchical timing wheel for timers
+//
+// $NoKeywords: $ivs_project_1 $timer_wheel.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file timer_wheel.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani hierarchickeho casovaciho kola.
+ */
+
+#pragma once
+
+#ifndef TIMER_WHEEL_H_
+#define TIMER_WHEEL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "heap_queue.h"
+#include "slab_pool.h"
+
+/**
+ * @brief The TimerWheel class
+ * Casovace s celociselnym casem (tiky) ulozene v hierarchickem casovacim
+ * kole. Kolo ma LEVELS urovni po SLOTS prihradkach, uroven "l" rozlisuje
+ * l-tou skupinu SLOT_BITS bitu casu vyprseni. Casovac lezi v nejnizsi urovni,
+ * ve ktere se jeho cas vyprseni lisi od aktualniho casu, pri prechodu do dalsi
+ * prihradky vyssi urovne se jeji casovace presunou do nizsich urovni.
+ * Casovace vzdalenejsi nez 2^(LEVELS * SLOT_BITS) tiku se ukladaji do haldy
+ * (BasicPriorityQueue) a do kola se presunou, az se k nim cas priblizi.
+ * Schedule a Cancel maji slozitost O(1) (mimo haldu), Advance preskakuje
+ * prazdne prihradky pomoci bitovych map.
+ */
+class TimerWheel
+{
+public:
+    /**
+     * @brief Pocet bitu casu na jednu uroven kola.
+     */
+    static const unsigned SLOT_BITS = 8;
+
+    /**
+     * @brief Pocet prihradek jedne urovne.
+     */
+    static const unsigned SLOTS = 1u << SLOT_BITS;
+
+    /**
+     * @brief Pocet urovni kola.
+     */
+    static const unsigned LEVELS = 4;
+
+    /**
+     * @brief The Timer_t struct
+     * Naplanovany casovac. Obsah se smi menit pouze metodami kola.
+     */
+    struct Timer_t {
+        uint64_t deadline;  ///< Cas vyprseni.
+        int value;          ///< Hodnota vracena pri vyprseni.
+
+        Timer_t *pNext;     ///< Nasledujici casovac v prihradce.
+        Timer_t **ppPrev;   ///< Odkaz, ktery na casovac ukazuje.
+        unsigned level;     ///< Uroven kola, LEVEL_OVERFLOW, LEVEL_DUE nebo LEVEL_CANCELLED.
+        unsigned slot;      ///< Prihradka v urovni.
+    };
+
+    /**
+     * @brief Handle_t
+     * Odkaz na casovac, platny dokud casovac nevyprsi nebo neni zrusen.
+     */
+    typedef Timer_t *Handle_t;
+
+    /**
+     * @brief TimerWheel
+     * Konstruktor, vytvori prazdne kolo s aktualnim casem "now".
+     * @param now Pocatecni cas.
+     */
+    explicit TimerWheel(uint64_t now = 0);
+
+    TimerWheel(const TimerWheel &) = delete;
+    TimerWheel &operator=(const TimerWheel &) = delete;
+
+    /**
+     * @brief Schedule
+     * Naplanuje casovac s hodnotou "value" na cas "deadline". Casovac s casem
+     * vyprseni, ktery jiz nastal, vyprsi pri pristim volani Advance.
+     * Slozitost O(1), u casovacu mimo rozsah kola O(log n).
+     * @param deadline Cas vyprseni.
+     * @param value Hodnota vracena pri vyprseni.
+     * @return Vraci odkaz na casovac.
+     */
+    Handle_t Schedule(uint64_t deadline, int value);
+
+    /**
+     * @brief Cancel
+     * Zrusi naplanovany casovac, odkaz tim prestava byt platny. Slozitost O(1).
+     * @param handle Odkaz na casovac, ktery jeste nevyprsel.
+     */
+    void Cancel(Handle_t handle);
+
+    /**
+     * @brief Advance
+     * Posune aktualni cas na "now" a vsechny casovace s casem vyprseni nejvyse
+     * "now" najednou odebere. Cas se nikdy nevraci zpet.
+     * @param now Novy aktualni cas.
+     * @param fired Vektor, na jehoz konec se pridaji hodnoty vyprselych
+     * casovacu v poradi jejich casu vyprseni.
+     * @return Vrati pocet vyprselych casovacu.
+     */
+    size_t Advance(uint64_t now, std::vector<int> &fired);
+
+    /**
+     * @brief Now
+     * @return Vraci aktualni cas kola.
+     */
+    uint64_t Now() const;
+
+    /**
+     * @brief Length
+     * @return Vraci pocet naplanovanych casovacu.
+     */
+    size_t Length() const;
+
+protected:
+    /**
+     * @brief Oznaceni casovacu mimo kolo (v halde, ve fronte k vyprseni a
+     * zrusenych casovacu cekajicich v halde na odstraneni).
+     */
+    static const unsigned LEVEL_OVERFLOW = LEVELS;
+    static const unsigned LEVEL_DUE = LEVELS + 1;
+    static const unsigned LEVEL_CANCELLED = LEVELS + 2;
+
+    /**
+     * @brief Pocet 64bitovych slov bitove mapy jedne urovne.
+     */
+    static const unsigned WORDS = SLOTS / 64;
+
+    /**
+     * @brief Nekonecny cas (zadna udalost).
+     */
+    static const uint64_t NEVER = ~static_cast<uint64_t>(0);
+
+    /**
+     * @brief The Overflow_t struct
+     * Polozka haldy casovacu mimo rozsah kola.
+     */
+    struct Overflow_t {
+        uint64_t deadline;  ///< Cas vyprseni casovace.
+        Timer_t *pTimer;    ///< Casovac.
+    };
+
+    /**
+     * @brief The OverflowCompare struct
+     * Na vrcholu haldy je casovac s nejmensim casem vyprseni.
+     */
+    struct OverflowCompare {
+        bool operator()(const Overflow_t &first, const Overflow_t &second) const
+        {
+            return first.deadline > second.deadline;
+        }
+    };
+
+    /**
+     * @brief Place
+     * Zaradi casovac do prihradky podle jeho casu vyprseni a aktualniho casu
+     * (cas vyprseni nesmi byt mensi nez aktualni cas).
+     */
+    void Place(Timer_t *timer);
+
+    /**
+     * @brief Link
+     * Vlozi casovac na zacatek seznamu "head".
+     */
+    static void Link(Timer_t **head, Timer_t *timer);
+
+    /**
+     * @brief NextEvent
+     * Nalezne nejblizsi cas po aktualnim case, ve kterem nektery casovac
+     * vyprsi nebo se musi presunout do nizsi urovne.
+     * @return Vraci cas udalosti, nebo NEVER.
+     */
+    uint64_t NextEvent();
+
+    /**
+     * @brief NextSlot
+     * @return Vraci nejblizsi obsazenou prihradku urovne "level" za
+     * prihradkou "slot", nebo SLOTS, pokud zadna neni.
+     */
+    unsigned NextSlot(unsigned level, unsigned slot) const;
+
+    /**
+     * @brief TakeSlot
+     * Vyjme vsechny casovace z prihradky a oznaci ji jako prazdnou.
+     * @return Vraci seznam vyjmutych casovacu.
+     */
+    Timer_t *TakeSlot(unsigned level, unsigned slot);
+
+    /**
+     * @brief Fire
+     * Prida hodnoty casovacu seznamu "list" do "fired" a casovace uvolni.
+     * @return Vrati pocet casovacu.
+     */
+    size_t Fire(Timer_t *list, std::vector<int> &fired);
+
+    Timer_t *m_apSlots[LEVELS][SLOTS];  ///< Prihradky vsech urovni.
+    uint64_t m_occupied[LEVELS][WORDS]; ///< Bitove mapy neprazdnych prihradek.
+    Timer_t *m_pDue;                    ///< Casovace, jejichz cas jiz nastal.
+    BasicPriorityQueue<Overflow_t, OverflowCompare> m_overflow; ///< Vzdalene casovace.
+    SlabPool<Timer_t> m_pool;           ///< Alokator casovacu.
+    uint64_t m_now;                     ///< Aktualni cas.
+    size_t m_length;                    ///< Pocet naplanovanych casovacu.
+};
+
+#endif // TIMER_WHEEL_H_
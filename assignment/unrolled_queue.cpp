@@ -0,0 +1,191 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - unrolled linked list with SIMD block scanning
+//
+// $NoKeywords: $ivs_project_1 $unrolled_queue.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file unrolled_queue.cpp
+ * @author Hung Do
+ *
+ * @brief Implementace metod prioritni fronty ulozene v blocich hodnot.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "unrolled_queue.h"
+
+const unsigned UnrolledPriorityQueue::CAPACITY;
+
+namespace {
+
+/**
+ * @brief PopCount
+ * @return Vraci pocet nastavenych bitu slova "word".
+ */
+inline unsigned PopCount(uint32_t word)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_popcount(word));
+#else
+    unsigned count = 0;
+    for (; word != 0; word &= word - 1)
+        count++;
+    return count;
+#endif
+}
+
+} // namespace
+
+UnrolledPriorityQueue::UnrolledPriorityQueue()
+    : m_pHead(nullptr), m_length(0)
+{
+}
+
+UnrolledPriorityQueue::~UnrolledPriorityQueue()
+{
+    // Bloky uvolni alokator najednou (destruktor m_pool)
+    m_pHead = nullptr;
+}
+
+void UnrolledPriorityQueue::Insert(int value)
+{
+    if (m_pHead == nullptr)
+        m_pHead = m_pool.Allocate();
+
+    // Prvni blok s nejmensi hodnotou <= "value", jinak posledni blok
+    Block_t *block = m_pHead;
+    while (block->pNext != nullptr && block->values[block->count - 1] > value)
+        block = block->pNext;
+
+    unsigned index = CountGreater(block, value);
+    if (block->count == CAPACITY)
+    {
+        // Rozdeleni plneho bloku, horni polovina hodnot se presune do noveho
+        Block_t *next = m_pool.Allocate();
+        const unsigned half = CAPACITY / 2;
+        memcpy(next->values, block->values + half, (CAPACITY - half) * sizeof(int));
+        next->count = CAPACITY - half;
+        next->pNext = block->pNext;
+        block->count = half;
+        block->pNext = next;
+
+        if (index > half)
+        {
+            block = next;
+            index -= half;
+        }
+    }
+
+    memmove(block->values + index + 1, block->values + index,
+            (block->count - index) * sizeof(int));
+    block->values[index] = value;
+    block->count++;
+    m_length++;
+}
+
+bool UnrolledPriorityQueue::Remove(int value)
+{
+    Block_t **link = &m_pHead;
+    while (*link != nullptr && (*link)->values[(*link)->count - 1] > value)
+        link = &(*link)->pNext;
+
+    Block_t *block = *link;
+    if (block == nullptr)
+        return false;
+
+    unsigned index = CountGreater(block, value);
+    if (block->values[index] != value)
+        return false;
+
+    block->count--;
+    memmove(block->values + index, block->values + index + 1,
+            (block->count - index) * sizeof(int));
+    m_length--;
+
+    if (block->count == 0)
+    {
+        // Prazdny blok se ze seznamu odstrani
+        *link = block->pNext;
+        m_pool.Release(block);
+    }
+    else if (block->count < CAPACITY / 2 && block->pNext != nullptr &&
+             block->count + block->pNext->count <= CAPACITY)
+    {
+        // Slouceni s nasledujicim blokem
+        Block_t *next = block->pNext;
+        memcpy(block->values + block->count, next->values, next->count * sizeof(int));
+        block->count += next->count;
+        block->pNext = next->pNext;
+        m_pool.Release(next);
+    }
+    return true;
+}
+
+bool UnrolledPriorityQueue::Find(int value) const
+{
+    const Block_t *block = m_pHead;
+    while (block != nullptr && block->values[block->count - 1] > value)
+        block = block->pNext;
+
+    return block != nullptr && block->values[CountGreater(block, value)] == value;
+}
+
+size_t UnrolledPriorityQueue::Length() const
+{
+    return m_length;
+}
+
+const UnrolledPriorityQueue::Block_t *UnrolledPriorityQueue::GetHead() const
+{
+    return m_pHead;
+}
+
+unsigned UnrolledPriorityQueue::CountGreater(const Block_t *block, int value)
+{
+#if defined(__SSE2__)
+    static_assert(CAPACITY % 4 == 0 && CAPACITY < 32,
+                  "Maska porovnani celeho bloku musi byt v jednom slove");
+
+    // Porovnani vsech hodnot bloku najednou, bity masky za platnymi
+    // hodnotami se nakonec vynuluji (alokator pamet bloku inicializuje)
+    uint32_t mask = 0;
+    unsigned i = 0;
+#if defined(__AVX2__)
+    const __m256i key8 = _mm256_set1_epi32(value);
+    for (; i + 8 <= CAPACITY; i += 8)
+    {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block->values + i));
+        __m256i greater = _mm256_cmpgt_epi32(values, key8);
+        mask |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(greater))) << i;
+    }
+#endif
+    const __m128i key4 = _mm_set1_epi32(value);
+    for (; i + 4 <= CAPACITY; i += 4)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block->values + i));
+        __m128i greater = _mm_cmpgt_epi32(values, key4);
+        mask |= static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(greater))) << i;
+    }
+    mask &= (static_cast<uint32_t>(1) << block->count) - 1;
+
+    // Hodnoty jsou serazene, vetsi hodnoty tvori souvisly zacatek bloku
+    return PopCount(mask);
+#else
+    unsigned index = 0;
+    while (index < block->count && block->values[index] > value)
+        index++;
+    return index;
+#endif
+}
+
+/*** Konec souboru unrolled_queue.cpp ***/
@@ -0,0 +1,126 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     Priority queue - unrolled linked list with SIMD block scanning
+//
+// $NoKeywords: $ivs_project_1 $unrolled_queue.h
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file unrolled_queue.h
+ * @author Hung Do
+ *
+ * @brief Definice rozhrani prioritni fronty ulozene v blocich hodnot.
+ */
+
+#pragma once
+
+#ifndef UNROLLED_QUEUE_H_
+#define UNROLLED_QUEUE_H_
+
+#include <stddef.h>
+
+#include "slab_pool.h"
+
+/**
+ * @brief The UnrolledPriorityQueue class
+ * Prioritni fronta (polozky vzdy serazeny od max po min) implementovana pomoci
+ * tzv. unrolled linked listu. Kazdy uzel seznamu nese misto jedne hodnoty cely
+ * serazeny blok hodnot, pruchod frontou tak cte souvislou pamet a na jeden
+ * vypadek cache pripada az CAPACITY hodnot misto jedne. Hledani pozice uvnitr
+ * bloku porovnava vice hodnot najednou (SSE2/AVX2, pokud je prekladac
+ * podporuje, jinak skalarne).
+ * Poradi hodnot pri pruchodu bloky (GetHead(), pNext a values[0..count)) je
+ * stejne jako poradi polozek PriorityQueue.
+ */
+class UnrolledPriorityQueue
+{
+public:
+    /**
+     * @brief Maximalni pocet hodnot v jednom bloku. Blok i s hlavickou zabira
+     * dva radky cache.
+     */
+    static const unsigned CAPACITY = 28;
+
+    /**
+     * @brief The Block_t struct
+     * Uzel seznamu, hodnoty values[0..count) jsou serazeny od max po min a
+     * vsechny jsou vetsi nebo rovny hodnotam nasledujiciho bloku.
+     */
+    struct Block_t {
+        Block_t *pNext;             ///< Ukazatel na nasledujici blok.
+        unsigned count;             ///< Pocet platnych hodnot v bloku.
+
+        int values[CAPACITY];       ///< Hodnoty bloku.
+    };
+
+    /**
+     * @brief UnrolledPriorityQueue
+     * Konstruktor, vytvori prazdnou frontu.
+     */
+    UnrolledPriorityQueue();
+
+    /**
+     * @brief ~UnrolledPriorityQueue
+     * Destruktor, odstrani vsechny bloky i frontu samotnou.
+     */
+    ~UnrolledPriorityQueue();
+
+    UnrolledPriorityQueue(const UnrolledPriorityQueue &) = delete;
+    UnrolledPriorityQueue &operator=(const UnrolledPriorityQueue &) = delete;
+
+    /**
+     * @brief Insert
+     * Zaradi novou hodnotu "value" do fronty na patricne misto (pred hodnoty
+     * se stejnou hodnotou). Plny blok se rozdeli na dve poloviny.
+     * @param value Hodnota nove polozky.
+     */
+    void Insert(int value);
+
+    /**
+     * @brief Remove
+     * Odstrani z fronty jednu polozku s hodnotou "value". Blok zaplneny z mene
+     * nez poloviny se slouci s nasledujicim blokem, pokud se do nej vejde.
+     * @param value Hodnota polozky, ktera ma byt odstranena.
+     * @return Vrati true, pokud byla polozka nalezena a odstranena, jinak vraci false.
+     */
+    bool Remove(int value);
+
+    /**
+     * @brief Find
+     * Zjisti, zda se ve fronte nachazi polozka s hodnotou "value".
+     * @param value Hodnota hledane polozky.
+     * @return Vrati true, pokud polozka existuje, jinak false.
+     */
+    bool Find(int value) const;
+
+    /**
+     * @brief Length
+     * Vraci delku fronty. Delka prazdne fronty je 0.
+     * @return Vrati delku fronty.
+     */
+    size_t Length() const;
+
+    /**
+     * @brief GetHead
+     * Vraci ukazatel na prvni blok fronty, jehoz prvni hodnota je vzdy zaroven
+     * nejvetsi hodnotou fronty. Fronta nikdy neobsahuje prazdny blok.
+     * @return Vraci ukazatel na 1. blok fronty, nebo NULL, pokud je fronta
+     * prazdna.
+     */
+    const Block_t *GetHead() const;
+
+protected:
+    /**
+     * @brief CountGreater
+     * @return Vraci pocet hodnot bloku vetsich nez "value", tedy index prvni
+     * hodnoty mensi nebo rovne "value".
+     */
+    static unsigned CountGreater(const Block_t *block, int value);
+
+    Block_t *m_pHead;           ///< Ukazatel na prvni blok fronty.
+    size_t m_length;            ///< Pocet hodnot ve fronte.
+    SlabPool<Block_t> m_pool;   ///< Alokator bloku fronty.
+};
+
+#endif // UNROLLED_QUEUE_H_
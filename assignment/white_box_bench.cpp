@@ -0,0 +1,149 @@
+//======== Copyright (c) 2021, FIT VUT Brno, All rights reserved. ============//
+//
+// Purpose:     White Box - benchmark of matrix multiplication
+//
+// $NoKeywords: $ivs_project_1 $white_box_bench.cpp
+// $Author:     Hung Do <xdohun00@stud.fit.vutbr.cz>
+// $Date:       $2021-01-04
+//============================================================================//
+/**
+ * @file white_box_bench.cpp
+ * @author Hung Do
+ *
+ * @brief Mereni vykonu nasobeni ctvercovych matic (GFLOP/s) pro
+ * Matrix::operator* (blokove nasobeni) a pro puvodni naivni nasobeni pres
+ * get/set. Pro kazdou velikost se vypise i nejvetsi odchylka vysledku obou
+ * metod. Vysledky se vypisuji ve formatu JSON na standardni vystup.
+ *
+ * Pouziti: white_box_bench [max. velikost matice]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "white_box_code.h"
+
+namespace {
+
+/**
+ * Vysledky mereni, aby je prekladac nemohl vynechat.
+ */
+volatile double g_sink = 0;
+
+/**
+ * @brief Random
+ * Jednoduchy linearni kongruencni generator (opakovatelne vysledky). Delitel
+ * neni mocnina dvou, soucty tedy nejsou presne a odchylka metod je videt.
+ * @return Vraci pseudonahodne cislo z intervalu <-1, 1>.
+ */
+double Random(unsigned &seed)
+{
+    seed = seed * 1103515245 + 12345;
+    return static_cast<double>(seed >> 8) / 8388607.0 - 1.0;
+}
+
+/**
+ * @brief Fill
+ * Naplni matici pseudonahodnymi hodnotami.
+ */
+void Fill(Matrix &matrix, unsigned seed)
+{
+    for (size_t r = 0; r < matrix.rows(); r++)
+    {
+        for (size_t c = 0; c < matrix.cols(); c++)
+            matrix.set(r, c, Random(seed));
+    }
+}
+
+/**
+ * @brief NaiveMultiply
+ * Puvodni nasobeni matic (i-j-k s pristupem pres get/set), slouzi jako
+ * srovnani.
+ */
+Matrix NaiveMultiply(Matrix &a, Matrix &b)
+{
+    Matrix result(a.rows(), b.cols());
+    for (size_t r = 0; r < a.rows(); r++)
+    {
+        for (size_t c = 0; c < b.cols(); c++)
+        {
+            for (size_t i = 0; i < a.cols(); i++)
+                result.set(r, c, result.get(r, c) + a.get(r, i) * b.get(i, c));
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Seconds
+ * @return Vraci cas od "start" v sekundach.
+ */
+double Seconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Measure
+ * Zmeri nasobeni ctvercovych matic velikosti "size" a vypise vysledek.
+ * Blokove nasobeni se opakuje, dokud mereni netrva alespon 0.2 s.
+ */
+void Measure(size_t size, bool first)
+{
+    Matrix a(size, size), b(size, size);
+    Fill(a, 1);
+    Fill(b, 2);
+    double flops = 2.0 * size * size * size;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    Matrix naive = NaiveMultiply(a, b);
+    double naiveTime = Seconds(start);
+
+    Matrix blocked;
+    size_t repeats = 0;
+    start = std::chrono::steady_clock::now();
+    do
+    {
+        blocked = a * b;
+        repeats++;
+    } while (Seconds(start) < 0.2);
+    double blockedTime = Seconds(start) / repeats;
+
+    double maxError = 0;
+    for (size_t r = 0; r < size; r++)
+    {
+        for (size_t c = 0; c < size; c++)
+            maxError = std::max(maxError, std::fabs(naive.get(r, c) - blocked.get(r, c)));
+    }
+    g_sink = g_sink + blocked.get(0, 0) + naive.get(0, 0);
+
+    printf("%s\n    {\"size\": %zu, \"naive_gflops\": %.3f, \"blocked_gflops\": %.3f, "
+           "\"speedup\": %.1f, \"max_error\": %.3g}",
+           first ? "" : ",", size, flops / naiveTime * 1e-9, flops / blockedTime * 1e-9,
+           naiveTime / blockedTime, maxError);
+    fflush(stdout);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    size_t maxSize = argc > 1 ? static_cast<size_t>(atol(argv[1])) : 1000;
+    const size_t sizes[] = { 64, 128, 256, 512, 1000, 2000 };
+
+    printf("{\n  \"benchmark\": \"white_box_bench\",\n  \"results\": [");
+    bool first = true;
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]) && sizes[i] <= maxSize; i++)
+    {
+        Measure(sizes[i], first);
+        first = false;
+    }
+    printf("\n  ]\n}\n");
+    return 0;
+}
+
+/*** Konec souboru white_box_bench.cpp ***/
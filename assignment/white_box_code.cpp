@@ -13,22 +13,227 @@
  * @brief Definice metod tridy reprezentujici matici.
  */
 
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "white_box_code.h"
 
-Matrix::Matrix(): mRows(1), mCols(1)
+/**
+ * @brief      StrideFor
+ *        * radky se doplni na nasobek 64 bajtu, aby kazdy zacinal na
+ *          zarovnane adrese
+ *
+ * @return     delka radku v pameti pro matici s "cols" sloupci
+ */
+static size_t StrideFor(size_t cols)
+{
+    const size_t lineElements = 64 / sizeof(double);
+    return (cols + lineElements - 1) / lineElements * lineElements;
+}
+
+/**
+ * @brief      rozmery bloku nasobeni matic
+ *        * blok A (MC x KC) se vejde do L2 cache, panel B (KC x NC) do L3
+ *          cache, mikrojadro pocita blok C (MR x NR) v lokalnich promennych
+ */
+static const size_t GEMM_MR = 4;
+static const size_t GEMM_NR = 8;
+static const size_t GEMM_KC = 256;
+static const size_t GEMM_MC = 128;
+static const size_t GEMM_NC = 1024;
+
+/**
+ * @brief      PackA
+ *        * zkopiruje blok A (mc x kc) po pruzich MR radku, v kazdem pruhu
+ *          lezi za sebou MR prvku jednoho sloupce, chybejici radky jsou nulove
+ */
+static void PackA(const double *a, size_t lda, size_t mc, size_t kc, double *packed)
+{
+    for(size_t i = 0; i < mc; i += GEMM_MR)
+    {
+        size_t mr = std::min(GEMM_MR, mc - i);
+        for(size_t p = 0; p < kc; p++)
+        {
+            for(size_t r = 0; r < GEMM_MR; r++)
+                *packed++ = r < mr ? a[(i + r) * lda + p] : 0.0;
+        }
+    }
+}
+
+/**
+ * @brief      PackB
+ *        * zkopiruje panel B (kc x nc) po pruzich NR sloupcu, v kazdem pruhu
+ *          lezi za sebou NR prvku jednoho radku, chybejici sloupce jsou nulove
+ */
+static void PackB(const double *b, size_t ldb, size_t kc, size_t nc, double *packed)
+{
+    for(size_t j = 0; j < nc; j += GEMM_NR)
+    {
+        size_t nr = std::min(GEMM_NR, nc - j);
+        for(size_t p = 0; p < kc; p++)
+        {
+            const double *row = b + p * ldb + j;
+            for(size_t c = 0; c < GEMM_NR; c++)
+                *packed++ = c < nr ? row[c] : 0.0;
+        }
+    }
+}
+
+/**
+ * @brief      MicroKernel
+ *        * pricte soucin pruhu A (MR x kc) a pruhu B (kc x NR) k bloku C,
+ *          soucty se drzi v registrech, zapisuje se jen platnych mr x nr
+ *          prvku
+ */
+static void MicroKernel(size_t kc, const double *a, const double *b, double *c, size_t ldc,
+                        size_t mr, size_t nr)
+{
+    double tile[GEMM_MR * GEMM_NR];
+
+#if defined(__AVX2__) && defined(__FMA__)
+    // Kazdy radek bloku C tvori dva 256bitove registry
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    for(size_t p = 0; p < kc; p++, a += GEMM_MR, b += GEMM_NR)
+    {
+        __m256d b0 = _mm256_load_pd(b);
+        __m256d b1 = _mm256_load_pd(b + 4);
+        __m256d ai = _mm256_broadcast_sd(a);
+        c00 = _mm256_fmadd_pd(ai, b0, c00);
+        c01 = _mm256_fmadd_pd(ai, b1, c01);
+        ai = _mm256_broadcast_sd(a + 1);
+        c10 = _mm256_fmadd_pd(ai, b0, c10);
+        c11 = _mm256_fmadd_pd(ai, b1, c11);
+        ai = _mm256_broadcast_sd(a + 2);
+        c20 = _mm256_fmadd_pd(ai, b0, c20);
+        c21 = _mm256_fmadd_pd(ai, b1, c21);
+        ai = _mm256_broadcast_sd(a + 3);
+        c30 = _mm256_fmadd_pd(ai, b0, c30);
+        c31 = _mm256_fmadd_pd(ai, b1, c31);
+    }
+    _mm256_storeu_pd(tile, c00);
+    _mm256_storeu_pd(tile + 4, c01);
+    _mm256_storeu_pd(tile + 8, c10);
+    _mm256_storeu_pd(tile + 12, c11);
+    _mm256_storeu_pd(tile + 16, c20);
+    _mm256_storeu_pd(tile + 20, c21);
+    _mm256_storeu_pd(tile + 24, c30);
+    _mm256_storeu_pd(tile + 28, c31);
+#elif defined(__SSE2__)
+    // 128bitovych registru je jen 16, blok C se pocita po dvou polovinach
+    // (4 x 4 prvku v osmi registrech)
+    for(size_t half = 0; half < GEMM_NR; half += 4)
+    {
+        const double *pa = a;
+        const double *pb = b + half;
+        __m128d c00 = _mm_setzero_pd(), c01 = _mm_setzero_pd();
+        __m128d c10 = _mm_setzero_pd(), c11 = _mm_setzero_pd();
+        __m128d c20 = _mm_setzero_pd(), c21 = _mm_setzero_pd();
+        __m128d c30 = _mm_setzero_pd(), c31 = _mm_setzero_pd();
+        for(size_t p = 0; p < kc; p++, pa += GEMM_MR, pb += GEMM_NR)
+        {
+            __m128d b0 = _mm_load_pd(pb);
+            __m128d b1 = _mm_load_pd(pb + 2);
+            __m128d ai = _mm_set1_pd(pa[0]);
+            c00 = _mm_add_pd(c00, _mm_mul_pd(ai, b0));
+            c01 = _mm_add_pd(c01, _mm_mul_pd(ai, b1));
+            ai = _mm_set1_pd(pa[1]);
+            c10 = _mm_add_pd(c10, _mm_mul_pd(ai, b0));
+            c11 = _mm_add_pd(c11, _mm_mul_pd(ai, b1));
+            ai = _mm_set1_pd(pa[2]);
+            c20 = _mm_add_pd(c20, _mm_mul_pd(ai, b0));
+            c21 = _mm_add_pd(c21, _mm_mul_pd(ai, b1));
+            ai = _mm_set1_pd(pa[3]);
+            c30 = _mm_add_pd(c30, _mm_mul_pd(ai, b0));
+            c31 = _mm_add_pd(c31, _mm_mul_pd(ai, b1));
+        }
+        _mm_storeu_pd(tile + half, c00);
+        _mm_storeu_pd(tile + half + 2, c01);
+        _mm_storeu_pd(tile + GEMM_NR + half, c10);
+        _mm_storeu_pd(tile + GEMM_NR + half + 2, c11);
+        _mm_storeu_pd(tile + 2 * GEMM_NR + half, c20);
+        _mm_storeu_pd(tile + 2 * GEMM_NR + half + 2, c21);
+        _mm_storeu_pd(tile + 3 * GEMM_NR + half, c30);
+        _mm_storeu_pd(tile + 3 * GEMM_NR + half + 2, c31);
+    }
+#else
+    for(size_t i = 0; i < GEMM_MR * GEMM_NR; i++)
+        tile[i] = 0;
+    for(size_t p = 0; p < kc; p++, a += GEMM_MR, b += GEMM_NR)
+    {
+        for(size_t r = 0; r < GEMM_MR; r++)
+            for(size_t j = 0; j < GEMM_NR; j++)
+                tile[r * GEMM_NR + j] += a[r] * b[j];
+    }
+#endif
+
+    for(size_t r = 0; r < mr; r++)
+    {
+        for(size_t j = 0; j < nr; j++)
+            c[r * ldc + j] += tile[r * GEMM_NR + j];
+    }
+}
+
+/**
+ * @brief      Gemm
+ *        * C += A * B pro matice ulozene po radcich (A je m x k, B k x n),
+ *          bloky A a B se pred nasobenim prekopiruji do souvislych pruhu
+ */
+static void Gemm(size_t m, size_t n, size_t k, const double *a, size_t lda,
+                 const double *b, size_t ldb, double *c, size_t ldc)
+{
+    std::vector<double, AlignedAllocator<double> > packedA(GEMM_MC * GEMM_KC);
+    std::vector<double, AlignedAllocator<double> >
+        packedB(GEMM_KC * ((std::min(GEMM_NC, n) + GEMM_NR - 1) / GEMM_NR * GEMM_NR));
+
+    for(size_t jc = 0; jc < n; jc += GEMM_NC)
+    {
+        size_t nc = std::min(GEMM_NC, n - jc);
+        for(size_t pc = 0; pc < k; pc += GEMM_KC)
+        {
+            size_t kc = std::min(GEMM_KC, k - pc);
+            PackB(b + pc * ldb + jc, ldb, kc, nc, &packedB[0]);
+
+            for(size_t ic = 0; ic < m; ic += GEMM_MC)
+            {
+                size_t mc = std::min(GEMM_MC, m - ic);
+                PackA(a + ic * lda + pc, lda, mc, kc, &packedA[0]);
+
+                for(size_t jr = 0; jr < nc; jr += GEMM_NR)
+                {
+                    for(size_t ir = 0; ir < mc; ir += GEMM_MR)
+                    {
+                        MicroKernel(kc, &packedA[ir * kc], &packedB[jr * kc],
+                                    c + (ic + ir) * ldc + jc + jr, ldc,
+                                    std::min(GEMM_MR, mc - ir), std::min(GEMM_NR, nc - jr));
+                    }
+                }
+            }
+        }
+    }
+}
+
+Matrix::Matrix(): mRows(1), mCols(1), mStride(StrideFor(1))
 {
-    matrix = std::vector<std::vector< double > >(1, std::vector<double>(1, 0));
+    matrix.assign(mRows * mStride, 0);
 }
 
-Matrix::Matrix(size_t row, size_t col): mRows(row), mCols(col)
+Matrix::Matrix(size_t row, size_t col): mRows(row), mCols(col), mStride(0)
 {
     if(row < 1 || col < 1)
         throw std::runtime_error("Minimalni velikost matice je 1x1");
     
-    matrix = std::vector<std::vector< double > >(row, std::vector<double>(col, 0));
+    mStride = StrideFor(col);
+    matrix.assign(mRows * mStride, 0);
 }
 
 Matrix::~Matrix()
@@ -41,39 +246,25 @@ bool Matrix::set(size_t row, size_t col, double value)
     if(!checkIndexes(row, col))
         return false;
     
-    matrix[row][col] = value;
+    matrix[row * mStride + col] = value;
     
     return true;
 }
 
 bool Matrix::set(std::vector<std::vector< double > > values)
 {
-    bool fit = true;
-
-    if(matrix.size() != values.size())
-    {
-        fit = false;
-    }
-
-    for(int r = 0; r < matrix.size(); r++)
-    {
-        if(values[r].size() != matrix[r].size())
-        {
-            fit = false;
-        }
-    }
+    if(values.size() != mRows)
+        return false;
 
-    if(!fit)
+    for(size_t r = 0; r < mRows; r++)
     {
-        return fit;
+        if(values[r].size() != mCols)
+            return false;
     }
     
-    for(int r = 0; r < matrix.size(); r++)
+    for(size_t r = 0; r < mRows; r++)
     {
-        for(int c = 0; c < matrix[0].size(); c++)
-        {
-            matrix[r][c] = values[r][c];
-        }
+        std::copy(values[r].begin(), values[r].end(), &matrix[r * mStride]);
     }
     
     return true;
@@ -84,7 +275,7 @@ double Matrix::get(size_t row, size_t col)
     if(!checkIndexes(row, col))
         throw std::runtime_error("Pristup k indexu mimo matici");
 
-    return matrix[row][col];
+    return matrix[row * mStride + col];
 }
 
 bool Matrix::operator==(const Matrix m) const
@@ -92,11 +283,13 @@ bool Matrix::operator==(const Matrix m) const
     if(!checkEqualSize(m))
         throw std::runtime_error("Matice musi mit stejnou velikost.");
     
-    for(int r = 0; r < matrix.size(); r++)
+    for(size_t r = 0; r < mRows; r++)
     {
-        for (int c = 0; c < matrix[r].size(); c++)
+        const double *row = &matrix[r * mStride];
+        const double *other = &m.matrix[r * m.mStride];
+        for(size_t c = 0; c < mCols; c++)
         {
-            if(matrix[r][c] != m.matrix[r][c])
+            if(row[c] != other[c])
                 return false;
         }
     }
@@ -109,14 +302,13 @@ Matrix Matrix::operator+(const Matrix m) const
     if(!checkEqualSize(m))
         throw std::runtime_error("Matice musi mit stejnou velikost.");
     
-    Matrix result = Matrix(matrix.size(), matrix[0].size());
+    Matrix result = Matrix(mRows, mCols);
     
-    for(int r = 0; r < matrix.size(); r++)
+    // Obe matice maji stejnou velikost a tedy i delku radku, doplnene nuly
+    // se sectou na nuly
+    for(size_t i = 0; i < matrix.size(); i++)
     {
-        for(int c = 0; c < matrix[r].size(); c++)
-        {
-            result.set(r, c, matrix[r][c] + m.matrix[r][c]);
-        }
+        result.matrix[i] = matrix[i] + m.matrix[i];
     }
     
     return result;
@@ -125,20 +317,12 @@ Matrix Matrix::operator+(const Matrix m) const
 
 Matrix Matrix::operator*(const Matrix m) const
 {
-    if(matrix[0].size() == m.matrix.size())
+    if(mCols == m.mRows)
     {
-        Matrix result = Matrix(matrix.size(), m.matrix[0].size());
+        Matrix result = Matrix(mRows, m.mCols);
         
-        for(int r = 0; r < matrix.size(); r++)
-        {
-            for(int c = 0; c < m.matrix[0].size(); c++)
-            {
-                for(int i = 0; i < matrix[r].size(); i++)
-                {
-                    result.set(r, c, result.get(r, c) +  matrix[r][i] * m.matrix[i][c]);
-                }
-            }
-        }
+        Gemm(mRows, m.mCols, mCols, &matrix[0], mStride, &m.matrix[0], m.mStride,
+             &result.matrix[0], result.mStride);
         
         return result;
     }
@@ -150,13 +334,15 @@ Matrix Matrix::operator*(const Matrix m) const
 
 Matrix Matrix::operator*(const double value) const
 {
-    Matrix result = Matrix(matrix.size(), matrix[0].size());
+    Matrix result = Matrix(mRows, mCols);
   
-    for(int r = 0; r < matrix.size(); r++)
+    for(size_t r = 0; r < mRows; r++)
     {
-        for(int c = 0; c < matrix[r].size(); c++)
+        const double *row = &matrix[r * mStride];
+        double *target = &result.matrix[r * mStride];
+        for(size_t c = 0; c < mCols; c++)
         {
-            result.set(r, c, matrix[r][c] * value);
+            target[c] = row[c] * value;
         }
     }
     
@@ -165,12 +351,9 @@ Matrix Matrix::operator*(const double value) const
 
 std::vector<double> Matrix::solveEquation(std::vector<double> b)
 {
-    std::vector<double> res = std::vector<double>(matrix.size(), 0);
+    std::vector<double> res = std::vector<double>(mRows, 0);
     
-    std::vector<std::vector<double> > temp = 
-        std::vector<std::vector< double > >(matrix.size(), std::vector<double>(matrix.size(), 0));
-        
-    if(matrix[0].size() != b.size())
+    if(mCols != b.size())
         throw std::runtime_error("Pocet prvku prave strany rovnice musi odpovidat poctu radku matice.");
     
     if(!checkSquare())
@@ -181,25 +364,25 @@ std::vector<double> Matrix::solveEquation(std::vector<double> b)
     if(abs(determinatAll) < std::numeric_limits<double>::epsilon())
         throw std::runtime_error("Matice je singularni.");
     
-    for(int i = 0; i < matrix.size(); i++)
+    // Husta kopie matice n x n bez doplneni radku
+    size_t n = mRows;
+    std::vector<double> temp = std::vector<double>(n * n, 0);
+    for(size_t i = 0; i < n; i++)
     {
-        for(int j = 0; j < matrix[i].size(); j++)
-        {
-            temp[i][j] = matrix[i][j];
-        }
+        std::copy(&matrix[i * mStride], &matrix[i * mStride] + n, &temp[i * n]);
     }
     
-    for(int i = 0; i < matrix.size(); i++)
+    for(size_t i = 0; i < n; i++)
     {
-        for(int k = 0; k < matrix[i].size(); k++)
+        for(size_t k = 0; k < n; k++)
         {
-            temp[k][i] = b[k];
+            temp[k * n + i] = b[k];
         }
         
-        res[i] = deter(temp, temp.size())/determinatAll;
+        res[i] = deter(temp, n)/determinatAll;
         
-        for(int k = 0; k < matrix[i].size(); k++)
-            temp[k][i] = matrix[k][i];
+        for(size_t k = 0; k < n; k++)
+            temp[k * n + i] = matrix[k * mStride + i];
     }
     
     return res;
@@ -207,7 +390,7 @@ std::vector<double> Matrix::solveEquation(std::vector<double> b)
 
 bool Matrix::checkIndexes(size_t row, size_t col)
 {
-    if(row >= matrix.size() || col >=  matrix[0].size())
+    if(row >= mRows || col >= mCols)
         return false;
   
     return true;
@@ -215,7 +398,7 @@ bool Matrix::checkIndexes(size_t row, size_t col)
 
 bool Matrix::checkSquare()
 {
-    if(matrix.size() == matrix[0].size())
+    if(mRows == mCols)
         return true;
     
     return false;
@@ -223,7 +406,7 @@ bool Matrix::checkSquare()
 
 bool Matrix::checkEqualSize(const Matrix m) const
 {
-    if(m.matrix.size() == matrix.size() && m.matrix[0].size() ==  matrix[0].size())
+    if(m.mRows == mRows && m.mCols == mCols)
         return true;
     
     return false;
@@ -231,68 +414,74 @@ bool Matrix::checkEqualSize(const Matrix m) const
 
 double Matrix::determinant()
 {
-    if(matrix.size() == 1)
+    const double *m0 = &matrix[0];
+
+    if(mRows == 1)
     {
-        return matrix[0][0];
+        return m0[0];
     }
-    else if(matrix.size() == 2)
+    else if(mRows == 2)
     {
-        return matrix[0][0]*matrix[1][1] - matrix[1][0]*matrix[0][1];
+        const double *m1 = m0 + mStride;
+        return m0[0]*m1[1] - m1[0]*m0[1];
     }
-    else if(matrix.size() == 3)
+    else if(mRows == 3)
     {
-        return matrix[0][0]*matrix[1][1]*matrix[2][2] +
-            matrix[0][1]*matrix[1][2]*matrix[2][0] + 
-            matrix[0][2]*matrix[1][0]*matrix[2][1] - 
-            matrix[2][0]*matrix[1][1]*matrix[0][2] - 
-            matrix[2][1]*matrix[1][2]*matrix[0][0] - 
-            matrix[2][2]*matrix[0][1]*matrix[1][0];
+        const double *m1 = m0 + mStride;
+        const double *m2 = m1 + mStride;
+        return m0[0]*m1[1]*m2[2] +
+            m0[1]*m1[2]*m2[0] + 
+            m0[2]*m1[0]*m2[1] - 
+            m2[0]*m1[1]*m0[2] - 
+            m2[1]*m1[2]*m0[0] - 
+            m2[2]*m0[1]*m1[0];
     
     }
     else
     {
-        return deter(matrix, matrix.size());
+        // Husta kopie matice n x n bez doplneni radku
+        std::vector<double> dense(mRows * mRows);
+        for(size_t r = 0; r < mRows; r++)
+        {
+            std::copy(&matrix[r * mStride], &matrix[r * mStride] + mRows, &dense[r * mRows]);
+        }
+        return deter(dense, mRows);
     }
 }
 
 
-std::vector< std::vector<double> > getMinimo( std::vector< std::vector<double> > src, int I, int J, int ordSrc )
+std::vector<double> getMinimo(const std::vector<double> &src, int I, int J, int ordSrc)
 {
-    std::vector< std::vector<double> > minimo( ordSrc-1, std::vector<double> (ordSrc-1,0));
+    std::vector<double> minimo((ordSrc-1) * (ordSrc-1), 0);
 
-    int rowCont = 0;
+    size_t pos = 0;
     
     for(int i=0; i < ordSrc; i++)
     {
-        int colCont = 0;
-        
         if(i != I)
         {
             for(int j=0; j < ordSrc; j++)
             {
                 if(j != J)
                 {
-                    minimo[rowCont][colCont] = src[i][j];
-                    colCont++; 
+                    minimo[pos++] = src[i * ordSrc + j];
                 }
             }
-            
-            rowCont++;
         }
     }
     
     return minimo;
 }
 
-double Matrix::deter(std::vector<std::vector<double> > m, size_t n)
+double Matrix::deter(const std::vector<double> &m, size_t n)
 {
     if(n == 1)
-        return m[0][0];
+        return m[0];
 
     if(n == 2)
     {
-        double mainDiag = m[0][0] * m[1][1];
-        double negDiag = m[1][0] * m[0][1];
+        double mainDiag = m[0] * m[3];
+        double negDiag = m[2] * m[1];
 
         return mainDiag - negDiag; 
     }
@@ -301,14 +490,14 @@ double Matrix::deter(std::vector<std::vector<double> > m, size_t n)
         double det = 0;
         for(int J = 0; J < n; J++)
         {
-            std::vector< std::vector<double> > min = getMinimo( m, 0, J, n);
+            std::vector<double> min = getMinimo( m, 0, J, n);
             if((J % 2) == 0)
             {
-                det += m[0][J] * deter( min, n-1);
+                det += m[J] * deter( min, n-1);
             }
             else
             {
-                det -= m[0][J] * deter( min, n-1);
+                det -= m[J] * deter( min, n-1);
             }
         }
         
@@ -321,11 +510,12 @@ double Matrix::deter(std::vector<std::vector<double> > m, size_t n)
 Matrix Matrix::transpose()
 {
     Matrix transposedMatrix(mCols, mRows);
-    for(int r = 0; r < mRows; r++)
+    for(size_t r = 0; r < mRows; r++)
     {
-        for(int c = 0; c < mCols; c++)
+        const double *row = &matrix[r * mStride];
+        for(size_t c = 0; c < mCols; c++)
         {
-            transposedMatrix.set(c,r, matrix[r][c]);
+            transposedMatrix.matrix[c * transposedMatrix.mStride + r] = row[c];
         }
     }
 
@@ -349,10 +539,10 @@ Matrix Matrix::inverse()
 
     if(mRows == 2 && mCols == 2)
     {
-        inversedMatrix.set(0, 0, matrix[1][1] / deter);
-        inversedMatrix.set(1, 0, -1.0 * matrix[1][0] / deter);
-        inversedMatrix.set(0, 1, -1.0 * matrix[0][1] / deter);
-        inversedMatrix.set(1, 1, matrix[0][0] / deter);
+        inversedMatrix.set(0, 0, get(1, 1) / deter);
+        inversedMatrix.set(1, 0, -1.0 * get(1, 0) / deter);
+        inversedMatrix.set(0, 1, -1.0 * get(0, 1) / deter);
+        inversedMatrix.set(1, 1, get(0, 0) / deter);
     }
     else
     {
@@ -360,7 +550,7 @@ Matrix Matrix::inverse()
         {
             for(int c = 0; c < mCols; c++)
             {
-                inversedMatrix.set(c, r, (matrix[(r+1)%3][(c+1)%3]*matrix[(r+2)%3][(c+2)%3] - matrix[(r+2)%3][(c+1)%3]*matrix[(r+1)%3][(c+2)%3]) / deter);
+                inversedMatrix.set(c, r, (get((r+1)%3, (c+1)%3)*get((r+2)%3, (c+2)%3) - get((r+2)%3, (c+1)%3)*get((r+1)%3, (c+2)%3)) / deter);
             }
         }
     }
@@ -368,4 +558,29 @@ Matrix Matrix::inverse()
     return inversedMatrix;
 }
 
+double *Matrix::data()
+{
+    return &matrix[0];
+}
+
+const double *Matrix::data() const
+{
+    return &matrix[0];
+}
+
+size_t Matrix::rows() const
+{
+    return mRows;
+}
+
+size_t Matrix::cols() const
+{
+    return mCols;
+}
+
+size_t Matrix::stride() const
+{
+    return mStride;
+}
+
 /*** Konec souboru white_box_code.cpp ***/
@@ -27,6 +27,8 @@
 #include <limits>
 #include <cmath>
 
+#include "aligned_allocator.h"
+
 /**
  * @brief Trida reprezuntiji matici
  * 
@@ -148,20 +150,64 @@ public:
    */
   Matrix inverse();
 
+  /**
+   * @brief      data
+   *        * prvky matice ulozene po radcich v jednom souvislem bloku,
+   *          radek "row" zacina na indexu row * stride()
+   *
+   * @return     ukazatel na prvni prvek matice (zarovnany na 64 bajtu)
+   */
+  double *data();
+
+  /**
+   * @brief      data
+   *
+   * @return     ukazatel na prvni prvek matice (zarovnany na 64 bajtu)
+   */
+  const double *data() const;
+
+  /**
+   * @brief      rows
+   *
+   * @return     pocet radku matice
+   */
+  size_t rows() const;
+
+  /**
+   * @brief      cols
+   *
+   * @return     pocet sloupcu matice
+   */
+  size_t cols() const;
+
+  /**
+   * @brief      stride
+   *        * vzdalenost zacatku dvou sousednich radku v poctu prvku, radky
+   *          jsou doplneny nulami tak, aby kazdy zacinal na zarovnane adrese
+   *
+   * @return     delka radku v pameti
+   */
+  size_t stride() const;
+
 
 
 
 
 protected:
   /**
-   * 2D pole reprezentujici matici
+   * prvky matice po radcich, radek "row" zacina na indexu row * mStride
    */
-  std::vector<std::vector<double> > matrix;
+  std::vector<double, AlignedAllocator<double> > matrix;
 
   size_t mRows;
   
   size_t mCols;
 
+  /**
+   * delka radku v pameti (mCols zaokrouhleno na nasobek 8 prvku)
+   */
+  size_t mStride;
+
   /**
    * @brief      kontrola zda indexy row, col jsou v matici
    *
@@ -197,11 +243,11 @@ protected:
   /**
    * @brief      Pomocna funkce pro vypocet determinantu matice vyssich radu
    *
-   * param       m matice 
+   * param       m matice n x n ulozena po radcich
    * param       n rad matice 
    * @return     Vrati hodnotu determinantu matice
    */
-  double deter(std::vector<std::vector<double> > m, size_t n);
+  double deter(const std::vector<double> &m, size_t n);
 };
 
 
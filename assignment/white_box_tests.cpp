@@ -215,6 +215,64 @@ TEST(UndefMatrix, MultiplyByMatrix)
     delete exp;
 }
 
+TEST(UndefMatrix, Layout)
+{
+    // Radky lezi v jednom zarovnanem bloku, doplnene na nasobek 8 prvku
+    Matrix m(3, 10);
+    EXPECT_EQ(m.rows(), 3);
+    EXPECT_EQ(m.cols(), 10);
+    EXPECT_EQ(m.stride(), 16);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(m.data()) % 64, 0);
+
+    EXPECT_TRUE(m.set(2, 9, 4.5));
+    EXPECT_TRUE(m.set(1, 0, -1.0));
+    EXPECT_EQ(m.data()[2 * m.stride() + 9], 4.5);
+    EXPECT_EQ(m.data()[1 * m.stride()], -1.0);
+
+    // Kopie ma vlastni zarovnany blok
+    Matrix copy = m * 2.0;
+    EXPECT_NE(copy.data(), m.data());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(copy.data()) % 64, 0);
+    EXPECT_EQ(copy.get(2, 9), 9.0);
+
+    Matrix transposed = m.transpose();
+    EXPECT_EQ(transposed.rows(), 10);
+    EXPECT_EQ(transposed.stride(), 8);
+    EXPECT_EQ(transposed.get(9, 2), 4.5);
+    EXPECT_EQ(transposed.get(0, 1), -1.0);
+}
+
+TEST(UndefMatrix, MultiplyBlocked)
+{
+    // Rozmery presahuji bloky nasobeni (KC = 256, NC = 1024) a nejsou
+    // nasobky rozmeru mikrojadra, celociselne hodnoty se sectou presne
+    const size_t M = 37, K = 261, N = 1029;
+    Matrix a(M, K), b(K, N);
+    for(size_t r = 0; r < M; r++)
+        for(size_t c = 0; c < K; c++)
+            a.set(r, c, static_cast<double>((r * 7 + c * 3) % 11) - 5.0);
+    for(size_t r = 0; r < K; r++)
+        for(size_t c = 0; c < N; c++)
+            b.set(r, c, static_cast<double>((r * 5 + c) % 13) - 6.0);
+
+    Matrix res = a * b;
+    ASSERT_EQ(res.rows(), M);
+    ASSERT_EQ(res.cols(), N);
+    for(size_t r = 0; r < M; r++)
+    {
+        for(size_t c = 0; c < N; c++)
+        {
+            double expected = 0;
+            for(size_t i = 0; i < K; i++)
+                expected += a.get(r, i) * b.get(i, c);
+            ASSERT_EQ(res.get(r, c), expected);
+        }
+        // Doplneni radku zustava nulove
+        for(size_t c = N; c < res.stride(); c++)
+            ASSERT_EQ(res.data()[r * res.stride() + c], 0.0);
+    }
+}
+
 TEST_F(InitMatrix, SetValue_Single)
 {
     ASSERT_NE(matrix, nullptr);